@@ -21,6 +21,13 @@ namespace UnrealBuildTool.Rules
 				}
 				);
 
+			PrivateDependencyModuleNames.AddRange(
+				new string[]
+				{
+					"Landscape"
+				}
+				);
+
             SetupModulePhysicsSupport(Target);
 			PrivateDefinitions.Add("CHAOS_INCLUDE_LEVEL_1=1");
 		}
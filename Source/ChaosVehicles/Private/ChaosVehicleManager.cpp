@@ -16,15 +16,22 @@
 DECLARE_CYCLE_STAT(TEXT("VehicleManager:ParallelUpdateVehicles"), STAT_ChaosVehicleManager_ParallelUpdateVehicles, STATGROUP_ChaosVehicleManager);
 DECLARE_CYCLE_STAT(TEXT("VehicleManager:Update"), STAT_ChaosVehicleManager_Update, STATGROUP_ChaosVehicleManager);
 DECLARE_CYCLE_STAT(TEXT("VehicleManager:ScenePreTick"), STAT_ChaosVehicleManager_ScenePreTick, STATGROUP_ChaosVehicleManager);
+DECLARE_CYCLE_STAT(TEXT("VehicleManager:UpdateSuspensionTraces"), STAT_ChaosVehicleManager_UpdateSuspensionTraces, STATGROUP_ChaosVehicleManager);
 
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumVehiclesTotal"), STAT_NumVehicles_Dynamic, STATGROUP_ChaosVehicleManager);
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumVehiclesAwake"), STAT_NumVehicles_Awake, STATGROUP_ChaosVehicleManager);
 DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumVehiclesSleeping"), STAT_NumVehicles_Sleeping, STATGROUP_ChaosVehicleManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumVehiclesParked"), STAT_NumVehicles_Parked, STATGROUP_ChaosVehicleManager);
 
 extern FVehicleDebugParams GVehicleDebugParams;
 
+// Outputs can run a few frames ahead of the game thread, this is enough to avoid growing in the common case
+static constexpr int32 InitialPendingOutputsCapacity = 8;
+
 TMap<FPhysScene*, FChaosVehicleManager*> FChaosVehicleManager::SceneToVehicleManagerMap;
 uint32 FChaosVehicleManager::VehicleSetupTag = 0;
+uint32 FChaosVehicleManager::VehicleTuningTag = 0;
+TMap<TWeakObjectPtr<const UObject>, uint32> FChaosVehicleManager::TuningChangeTags;
 
 FDelegateHandle FChaosVehicleManager::OnPostWorldInitializationHandle;
 FDelegateHandle FChaosVehicleManager::OnWorldCleanupHandle;
@@ -51,11 +58,17 @@ void OnWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
 
 FChaosVehicleManager::FChaosVehicleManager(FPhysScene* PhysScene)
 	: Scene(*PhysScene)
+	, FirstFreeSlot(INDEX_NONE)
 	, AsyncCallback(nullptr)
 	, Timestamp(0)
+	, CompletedTimestamp(INDEX_NONE)
+	, PendingOutputsHead(0)
+	, NumPendingOutputs(0)
 {
 	check(PhysScene);
 
+	PendingOutputs.SetNum(InitialPendingOutputsCapacity);
+
 	if (!GInitialized)
 	{
 		GInitialized = true;
@@ -115,6 +128,37 @@ FChaosVehicleManager::~FChaosVehicleManager()
 	{
 		RemoveVehicle(Vehicles.Last());
 	}
+
+	// the scene is being torn down and won't step again
+	EmptyVehiclePool();
+	RetiredVehicles.Empty();
+}
+
+void FChaosVehicleManager::NotifyTuningChanged(const UObject* Setup)
+{
+	check(Setup);
+
+	for (auto It = TuningChangeTags.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TuningChangeTags.Add(Setup, ++VehicleTuningTag);
+
+	// parked simulations can't be patched, other vehicle classes using an edited wheel class are discarded as they are taken
+	for (const TPair<FPhysScene*, FChaosVehicleManager*>& SceneAndManager : SceneToVehicleManagerMap)
+	{
+		SceneAndManager.Value->FlushParkedVehicles(Setup);
+	}
+}
+
+bool FChaosVehicleManager::HasTuningChanged(const UObject* Setup, uint32 SinceTag)
+{
+	const uint32* ChangeTag = TuningChangeTags.Find(Setup);
+	return ChangeTag && *ChangeTag > SinceTag;
 }
 
 FChaosVehicleManager* FChaosVehicleManager::GetVehicleManagerFromScene(FPhysScene* PhysScene)
@@ -133,8 +177,29 @@ void FChaosVehicleManager::AddVehicle(TWeakObjectPtr<UChaosVehicleMovementCompon
 	check(Vehicle != NULL);
 	check(Vehicle->PhysicsVehicleOutput());
 	check(AsyncCallback);
+	check(!Vehicle->VehicleHandle.IsValid());
+
+	int32 SlotIdx = FirstFreeSlot;
+	if (SlotIdx != INDEX_NONE)
+	{
+		FirstFreeSlot = VehicleSlots[SlotIdx].NextFreeSlot;
+	}
+	else
+	{
+		SlotIdx = VehicleSlots.AddDefaulted();
+	}
+
+	FVehicleSlot& Slot = VehicleSlots[SlotIdx];
+	Slot.NextFreeSlot = INDEX_NONE;
+	Slot.DenseIdx = Vehicles.Add(Vehicle);
+	VehicleSlotIndices.Add(SlotIdx);
 
-	Vehicles.Add(Vehicle);
+	Vehicle->VehicleHandle.Index = SlotIdx;
+	Vehicle->VehicleHandle.Generation = Slot.Generation;
+
+	// vehicles start in the awake batch, ProcessSleeping will move them out once they settle
+	Vehicle->VehicleState.bSleeping = false;
+	SetVehicleAwake(Vehicle.Get(), true);
 }
 
 void FChaosVehicleManager::RemoveVehicle(TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle)
@@ -142,7 +207,29 @@ void FChaosVehicleManager::RemoveVehicle(TWeakObjectPtr<UChaosVehicleMovementCom
 	check(Vehicle != NULL);
 	check(Vehicle->PhysicsVehicleOutput());
 
-	Vehicles.Remove(Vehicle);
+	// outputs this vehicle is viewing will be released without it
+	Vehicle->MaterializeOutputView();
+	SetVehicleAwake(Vehicle.Get(), false);
+
+	const FChaosVehicleHandle Handle = Vehicle->VehicleHandle;
+	if (ensure(GetVehicle(Handle) == Vehicle.Get()))
+	{
+		FVehicleSlot& Slot = VehicleSlots[Handle.Index];
+		const int32 RemoveIdx = Slot.DenseIdx;
+
+		Vehicles.RemoveAtSwap(RemoveIdx, 1, false);
+		VehicleSlotIndices.RemoveAtSwap(RemoveIdx, 1, false);
+		if (RemoveIdx < Vehicles.Num())
+		{
+			VehicleSlots[VehicleSlotIndices[RemoveIdx]].DenseIdx = RemoveIdx;
+		}
+
+		Slot.Generation++;
+		Slot.DenseIdx = INDEX_NONE;
+		Slot.NextFreeSlot = FirstFreeSlot;
+		FirstFreeSlot = Handle.Index;
+	}
+	Vehicle->VehicleHandle.Reset();
 
 	if (Vehicle->PhysicsVehicleOutput().IsValid())
 	{
@@ -151,14 +238,268 @@ void FChaosVehicleManager::RemoveVehicle(TWeakObjectPtr<UChaosVehicleMovementCom
 
 }
 
+void FChaosVehicleManager::ParkVehicle(TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle)
+{
+	check(Vehicle != NULL);
+
+	// inputs already filled hold on to the simulation, it isn't reused or freed until the physics thread has run them
+	FParkedVehicle Parked;
+	Parked.Simulation = MoveTemp(Vehicle->VehicleSimulationPT);
+	Parked.VehicleSetupTag = Vehicle->VehicleSetupTag;
+	Parked.VehicleTuningTag = Vehicle->VehicleTuningTag;
+	Parked.ReadyTimestamp = Timestamp;
+	RemoveVehicle(Vehicle);
+
+	if (!Parked.Simulation.IsValid())
+	{
+		return;
+	}
+
+	if (!Parked.Simulation->PVehicle.IsValid())
+	{
+		RetireVehicle(MoveTemp(Parked));
+		return;
+	}
+
+	const UObject* Archetype = Vehicle->GetArchetype();
+	if (!ParkedVehicles.Contains(Archetype))
+	{
+		// first vehicle of this class, a good time to drop the pools of classes that have since been unloaded
+		for (auto It = ParkedVehicles.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				DEC_DWORD_STAT_BY(STAT_NumVehicles_Parked, It->Value.Num());
+				for (FParkedVehicle& Stale : It->Value)
+				{
+					RetireVehicle(MoveTemp(Stale));
+				}
+				It.RemoveCurrent();
+			}
+		}
+
+		for (auto It = VehicleTemplates.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	TArray<FParkedVehicle>& Pool = ParkedVehicles.FindOrAdd(Archetype);
+	if (Pool.Num() >= GVehicleDebugParams.MaxParkedVehicles)
+	{
+		RetireVehicle(MoveTemp(Parked));
+		return;
+	}
+
+	Pool.Add(MoveTemp(Parked));
+	INC_DWORD_STAT(STAT_NumVehicles_Parked);
+}
+
+TUniquePtr<UChaosVehicleSimulation> FChaosVehicleManager::TakeParkedVehicle(const UChaosVehicleMovementComponent* Vehicle)
+{
+	check(Vehicle);
+
+	TArray<FParkedVehicle>* Pool = ParkedVehicles.Find(Vehicle->GetArchetype());
+	if (Pool == nullptr)
+	{
+		return nullptr;
+	}
+
+	// entries are parked in order so the ones most likely to be ready are at the front
+	for (int32 ParkedIdx = 0; ParkedIdx < Pool->Num(); )
+	{
+		FParkedVehicle& Parked = (*Pool)[ParkedIdx];
+		if (Parked.VehicleSetupTag != FChaosVehicleManager::VehicleSetupTag || Vehicle->IsTuningChanged(Parked.VehicleTuningTag))
+		{
+			// built from an out of date setup
+			RetireVehicle(MoveTemp(Parked));
+			Pool->RemoveAt(ParkedIdx, 1, false);
+			DEC_DWORD_STAT(STAT_NumVehicles_Parked);
+			continue;
+		}
+
+		if (IsReady(Parked))
+		{
+			TUniquePtr<UChaosVehicleSimulation> Simulation = MoveTemp(Parked.Simulation);
+			Pool->RemoveAt(ParkedIdx, 1, false);
+			DEC_DWORD_STAT(STAT_NumVehicles_Parked);
+			return Simulation;
+		}
+
+		ParkedIdx++;
+	}
+
+	return nullptr;
+}
+
+void FChaosVehicleManager::CaptureVehicleTemplate(const UChaosVehicleMovementComponent* Vehicle)
+{
+	check(Vehicle);
+
+	if (!Vehicle->VehicleSimulationPT.IsValid() || !Vehicle->VehicleSimulationPT->PVehicle.IsValid() || !Vehicle->CanParkVehicle())
+	{
+		return;
+	}
+
+	FParkedVehicle& Template = VehicleTemplates.FindOrAdd(Vehicle->GetArchetype());
+	if (Template.Simulation.IsValid() && Template.VehicleSetupTag == Vehicle->VehicleSetupTag && !Vehicle->IsTuningChanged(Template.VehicleTuningTag))
+	{
+		return;
+	}
+
+	// nothing has run the simulation yet, so the copy only holds what was built from the setup
+	Template.Simulation = Vehicle->VehicleSimulationPT->Clone();
+	Template.VehicleSetupTag = Vehicle->VehicleSetupTag;
+	Template.VehicleTuningTag = Vehicle->VehicleTuningTag;
+	Template.ReadyTimestamp = INDEX_NONE;
+}
+
+void FChaosVehicleManager::PrewarmVehicles(const UChaosVehicleMovementComponent* Vehicle, int32 Count)
+{
+	check(Vehicle);
+
+	const FParkedVehicle* Template = VehicleTemplates.Find(Vehicle->GetArchetype());
+	if (Template == nullptr || !Template->Simulation.IsValid() || Template->VehicleSetupTag != FChaosVehicleManager::VehicleSetupTag || Vehicle->IsTuningChanged(Template->VehicleTuningTag))
+	{
+		return;
+	}
+
+	TArray<FParkedVehicle>& Pool = ParkedVehicles.FindOrAdd(Vehicle->GetArchetype());
+	Count = FMath::Min(Count, GVehicleDebugParams.MaxParkedVehicles);
+
+	while (Pool.Num() < Count)
+	{
+		FParkedVehicle& Parked = Pool.AddDefaulted_GetRef();
+		Parked.Simulation = Template->Simulation->Clone();
+		Parked.VehicleSetupTag = Template->VehicleSetupTag;
+		Parked.VehicleTuningTag = Template->VehicleTuningTag;
+		Parked.ReadyTimestamp = INDEX_NONE;	// never been stepped
+		INC_DWORD_STAT(STAT_NumVehicles_Parked);
+	}
+}
+
+int32 FChaosVehicleManager::GetNumParkedVehicles(const UChaosVehicleMovementComponent* Vehicle) const
+{
+	check(Vehicle);
+
+	const TArray<FParkedVehicle>* Pool = ParkedVehicles.Find(Vehicle->GetArchetype());
+	return Pool ? Pool->Num() : 0;
+}
+
+void FChaosVehicleManager::EmptyVehiclePool()
+{
+	for (TPair<TWeakObjectPtr<const UObject>, TArray<FParkedVehicle>>& Pool : ParkedVehicles)
+	{
+		DEC_DWORD_STAT_BY(STAT_NumVehicles_Parked, Pool.Value.Num());
+		for (FParkedVehicle& Parked : Pool.Value)
+		{
+			RetireVehicle(MoveTemp(Parked));
+		}
+	}
+
+	ParkedVehicles.Empty();
+	VehicleTemplates.Empty();
+}
+
+void FChaosVehicleManager::FlushParkedVehicles(const UObject* Setup)
+{
+	if (TArray<FParkedVehicle>* Pool = ParkedVehicles.Find(Setup))
+	{
+		DEC_DWORD_STAT_BY(STAT_NumVehicles_Parked, Pool->Num());
+		for (FParkedVehicle& Parked : *Pool)
+		{
+			RetireVehicle(MoveTemp(Parked));
+		}
+		ParkedVehicles.Remove(Setup);
+	}
+
+	VehicleTemplates.Remove(Setup);
+}
+
+void FChaosVehicleManager::RetireVehicle(FParkedVehicle&& Parked)
+{
+	if (IsReady(Parked))
+	{
+		Parked.Simulation.Reset();
+	}
+	else
+	{
+		RetiredVehicles.Add(MoveTemp(Parked));
+	}
+}
+
+void FChaosVehicleManager::ReleaseRetiredVehicles()
+{
+	for (int32 RetiredIdx = RetiredVehicles.Num() - 1; RetiredIdx >= 0; --RetiredIdx)
+	{
+		if (IsReady(RetiredVehicles[RetiredIdx]))
+		{
+			RetiredVehicles.RemoveAtSwap(RetiredIdx, 1, false);
+		}
+	}
+}
+
+UChaosVehicleMovementComponent* FChaosVehicleManager::GetVehicle(const FChaosVehicleHandle& Handle) const
+{
+	if (VehicleSlots.IsValidIndex(Handle.Index))
+	{
+		const FVehicleSlot& Slot = VehicleSlots[Handle.Index];
+		if (Slot.Generation == Handle.Generation && Slot.DenseIdx != INDEX_NONE)
+		{
+			return Vehicles[Slot.DenseIdx].Get();
+		}
+	}
+	return nullptr;
+}
+
+void FChaosVehicleManager::SetVehicleAwake(UChaosVehicleMovementComponent* Vehicle, bool bAwake)
+{
+	check(Vehicle);
+
+	if (bAwake && Vehicle->AwakeVehicleIdx == INDEX_NONE)
+	{
+		Vehicle->AwakeVehicleIdx = AwakeVehicles.Add(Vehicle);
+	}
+	else if (!bAwake && Vehicle->AwakeVehicleIdx != INDEX_NONE)
+	{
+		const int32 RemoveIdx = Vehicle->AwakeVehicleIdx;
+		check(AwakeVehicles[RemoveIdx] == Vehicle);
+
+		AwakeVehicles.RemoveAtSwap(RemoveIdx, 1, false);
+		if (RemoveIdx < AwakeVehicles.Num())
+		{
+			AwakeVehicles[RemoveIdx]->AwakeVehicleIdx = RemoveIdx;
+		}
+		Vehicle->AwakeVehicleIdx = INDEX_NONE;
+	}
+}
+
 void FChaosVehicleManager::ScenePreTick(FPhysScene* PhysScene, float DeltaTime)
 {
 	// inputs being set via back door, i.e. accessing PVehicle directly is a no go now, needs to go through async input system
 	SCOPE_CYCLE_COUNTER(STAT_ChaosVehicleManager_ScenePreTick);
 
-	for (int32 i = 0; i < Vehicles.Num(); ++i)
+	if (GVehicleDebugParams.DisableVehicleSleep && AwakeVehicles.Num() != Vehicles.Num())
+	{
+		for (TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle : Vehicles)
+		{
+			SetVehicleAwake(Vehicle.Get(), true);
+		}
+	}
+
+	// edits apply to sleeping vehicles too, iterate backwards as a rebuilt vehicle is swapped out and added again at the end
+	for (int32 i = Vehicles.Num() - 1; i >= 0; --i)
+	{
+		Vehicles[i]->UpdateSetupChanges();
+	}
+
+	// iterate backwards, a vehicle falling asleep is swapped out with an entry that has already been processed
+	for (int32 i = AwakeVehicles.Num() - 1; i >= 0; --i)
 	{
-		Vehicles[i]->PreTickGT(DeltaTime);
+		AwakeVehicles[i]->PreTickGT(DeltaTime);
 	}
 
 }
@@ -177,8 +518,10 @@ void FChaosVehicleManager::Update(FPhysScene* PhysScene, float DeltaTime)
 
 	if (World)
 	{
+		UpdateSuspensionTraces(World);
+
 		FChaosVehicleManagerAsyncInput* AsyncInput = AsyncCallback->GetProducerInputData_External();
-		for (TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle : Vehicles)
+		for (TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle : AwakeVehicles)
 		{
 			Vehicle->Update(DeltaTime);
 			Vehicle->FinalizeSimCallbackData(*AsyncInput);
@@ -190,16 +533,8 @@ void FChaosVehicleManager::PostUpdate(FChaosScene* PhysScene)
 {
 	SET_DWORD_STAT(STAT_NumVehicles_Dynamic, Vehicles.Num());
 
-	int32 SleepingCount = 0;
-	for (int32 i = 0; i < Vehicles.Num(); ++i)
-	{
-		if (Vehicles[i]->VehicleState.bSleeping)
-		{
-			SleepingCount++;
-		}
-	}
-	SET_DWORD_STAT(STAT_NumVehicles_Awake, Vehicles.Num() - SleepingCount);
-	SET_DWORD_STAT(STAT_NumVehicles_Sleeping, SleepingCount);
+	SET_DWORD_STAT(STAT_NumVehicles_Awake, AwakeVehicles.Num());
+	SET_DWORD_STAT(STAT_NumVehicles_Sleeping, Vehicles.Num() - AwakeVehicles.Num());
 
 }
 
@@ -213,7 +548,7 @@ void FChaosVehicleManager::ParallelUpdateVehicles(float DeltaSeconds)
 
 	{
 		// We pass pointers from TArray so this reserve is critical. Otherwise realloc happens
-		AsyncInput->VehicleInputs.Reserve(Vehicles.Num());
+		AsyncInput->VehicleInputs.Reserve(AwakeVehicles.Num());
 		AsyncInput->Timestamp = Timestamp;
 		AsyncInput->World = Scene.GetOwningWorld();
 	}
@@ -223,18 +558,21 @@ void FChaosVehicleManager::ParallelUpdateVehicles(float DeltaSeconds)
 		Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput> AsyncOutputLatest;
 		while ((AsyncOutputLatest = AsyncCallback->PopFutureOutputData_External()))
 		{
-			PendingOutputs.Emplace(MoveTemp(AsyncOutputLatest));
+			CompletedTimestamp = FMath::Max(CompletedTimestamp, AsyncOutputLatest->Timestamp);
+			PushPendingOutput(MoveTemp(AsyncOutputLatest));
 		}
 	}
 
+	ReleaseRetiredVehicles();
+
 	// Since we are in pre-physics, delta seconds is not accounted for in external time yet
 	const float ResultsTime = AsyncCallback->GetSolver()->GetPhysicsResultsTime_External() + DeltaSeconds;
 
 	// Find index of first non-consumable output (first one after current time)
 	int32 LastOutputIdx = 0;
-	for (; LastOutputIdx < PendingOutputs.Num(); ++LastOutputIdx)
+	for (; LastOutputIdx < NumPendingOutputs; ++LastOutputIdx)
 	{
-		if (PendingOutputs[LastOutputIdx]->InternalTime > ResultsTime)
+		if (GetPendingOutput(LastOutputIdx)->InternalTime > ResultsTime)
 		{
 			break;
 		}
@@ -250,20 +588,12 @@ void FChaosVehicleManager::ParallelUpdateVehicles(float DeltaSeconds)
 	//	}
 	//}
 
-	// Cache the last consumed output for interpolation
+	// Cache the last consumed output for interpolation. Vehicle output views may still reference the previous one, so it is only released on exit
+	Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput> PreviousLatestOutput;
 	if (LastOutputIdx > 0)
 	{
-		LatestOutput = MoveTemp(PendingOutputs[LastOutputIdx - 1]);
-	}
-
-	// Remove all consumed outputs
-	{
-		TArray<Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput>> NewPendingOutputs;
-		for (int32 OutputIdx = LastOutputIdx; OutputIdx < PendingOutputs.Num(); ++OutputIdx)
-		{
-			NewPendingOutputs.Emplace(MoveTemp(PendingOutputs[OutputIdx]));
-		}
-		PendingOutputs = MoveTemp(NewPendingOutputs);
+		PreviousLatestOutput = MoveTemp(LatestOutput);
+		LatestOutput = MoveTemp(GetPendingOutput(LastOutputIdx - 1));
 	}
 
 	// It's possible we will end up multiple frames ahead of output, take the latest ready output.
@@ -282,10 +612,10 @@ void FChaosVehicleManager::ParallelUpdateVehicles(float DeltaSeconds)
 
 	if (UWorld* World = Scene.GetOwningWorld())
 	{
-		int32 NumVehiclesInActiveBatch = 0;
-		for (TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle : Vehicles)
+		// sleeping vehicles get no input, so are also skipped by the physics thread simulation
+		for (TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle : AwakeVehicles)
 		{
-			auto NextOutput = PendingOutputs.Num() > 0 ? PendingOutputs[0].Get() : nullptr;
+			auto NextOutput = NumPendingOutputs > LastOutputIdx ? GetPendingOutput(LastOutputIdx).Get() : nullptr;
 			float Alpha = 0.f;
 			if (NextOutput && LatestOutput)
 			{
@@ -296,13 +626,15 @@ void FChaosVehicleManager::ParallelUpdateVehicles(float DeltaSeconds)
 				}
 			}
 
-			AsyncInput->VehicleInputs.Add(Vehicle->SetCurrentAsyncInputOutput(AsyncInput->VehicleInputs.Num(), LatestOutput.Get(), NextOutput, Alpha, Timestamp));
+			TUniquePtr<FChaosVehicleAsyncInput> VehicleInput = AsyncInput->AcquireVehicleInput();
+			Vehicle->SetCurrentAsyncInputOutputInternal(VehicleInput.Get(), AsyncInput->VehicleInputs.Num(), LatestOutput.Get(), NextOutput, Alpha, Timestamp);
+			AsyncInput->VehicleInputs.Add(MoveTemp(VehicleInput));
 		}
 	}
 
 	++Timestamp;
 
-	const auto& AwakeVehiclesBatch = Vehicles; // TODO: process awake only
+	const auto& AwakeVehiclesBatch = AwakeVehicles;
 
 	auto LambdaParallelUpdate = [DeltaSeconds, &AwakeVehiclesBatch](int32 Idx)
 	{
@@ -312,4 +644,125 @@ void FChaosVehicleManager::ParallelUpdateVehicles(float DeltaSeconds)
 
 	bool ForceSingleThread = !GVehicleDebugParams.EnableMultithreading;
 	ParallelFor(AwakeVehiclesBatch.Num(), LambdaParallelUpdate, ForceSingleThread);
+
+	// Remove all consumed outputs, every vehicle now views or has copied the latest ones
+	PopPendingOutputs(LastOutputIdx);
+}
+
+void FChaosVehicleManager::RequestSuspensionTrace(const FChaosVehicleHandle& Vehicle, int32 WheelIndex, const FVector& Start, const FVector& End, float SweepRadius, bool bTraceComplex, const FCollisionResponseContainer& CollisionResponse, const FTransform& VehicleWorldTransform)
+{
+	check(IsInGameThread());
+
+	FSuspensionTraceRequest& Request = QueuedSuspensionTraces.AddDefaulted_GetRef();
+	Request.Vehicle = Vehicle;
+	Request.WheelIndex = WheelIndex;
+	Request.Start = Start;
+	Request.End = End;
+	Request.SweepRadius = SweepRadius;
+	Request.bTraceComplex = bTraceComplex;
+	Request.CollisionResponse = CollisionResponse;
+	Request.VehicleWorldTransform = VehicleWorldTransform;
+}
+
+void FChaosVehicleManager::UpdateSuspensionTraces(UWorld* World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ChaosVehicleManager_UpdateSuspensionTraces);
+
+	// async trace results are only kept for the frame after they were issued, anything not ready by then is dropped
+	for (int32 Idx = InFlightSuspensionTraces.Num() - 1; Idx >= 0; --Idx)
+	{
+		const FSuspensionTraceRequest& Request = InFlightSuspensionTraces[Idx];
+
+		FTraceDatum TraceData;
+		const bool bReady = World->QueryTraceData(Request.TraceHandle, TraceData);
+		if (!bReady && World->IsTraceHandleValid(Request.TraceHandle, false))
+		{
+			continue;
+		}
+
+		if (UChaosVehicleMovementComponent* Vehicle = GetVehicle(Request.Vehicle))
+		{
+			if (bReady)
+			{
+				const FHitResult NoHit;
+				Vehicle->SetSuspensionTraceResult(Request.WheelIndex, TraceData.OutHits.Num() > 0 ? &TraceData.OutHits[0] : &NoHit, Request.VehicleWorldTransform);
+			}
+			else
+			{
+				Vehicle->SetSuspensionTraceResult(Request.WheelIndex, nullptr, Request.VehicleWorldTransform);
+			}
+		}
+
+		InFlightSuspensionTraces.RemoveAtSwap(Idx, 1, false);
+	}
+
+	if (QueuedSuspensionTraces.Num() == 0)
+	{
+		return;
+	}
+
+	ECollisionChannel SpringCollisionChannel = ECollisionChannel::ECC_WorldDynamic;
+	FCollisionQueryParams TraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), false, nullptr);
+	TraceParams.bReturnPhysicalMaterial = true;	// we need this to get the surface friction coefficient
+	FCollisionResponseParams ResponseParams;
+
+	for (FSuspensionTraceRequest& Request : QueuedSuspensionTraces)
+	{
+		UChaosVehicleMovementComponent* Vehicle = GetVehicle(Request.Vehicle);
+		if (Vehicle == nullptr)
+		{
+			continue;
+		}
+
+		TraceParams.ClearIgnoredActors();
+		TraceParams.AddIgnoredActor(Vehicle->GetPawnOwner()); // ignore self in scene query
+		TraceParams.bTraceComplex = Request.bTraceComplex;
+		ResponseParams.CollisionResponse = Request.CollisionResponse;
+
+		if (Request.SweepRadius > 0.f)
+		{
+			Request.TraceHandle = World->AsyncSweepByChannel(EAsyncTraceType::Single, Request.Start, Request.End, FQuat::Identity, SpringCollisionChannel
+				, FCollisionShape::MakeSphere(Request.SweepRadius), TraceParams, ResponseParams);
+		}
+		else
+		{
+			Request.TraceHandle = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, SpringCollisionChannel, TraceParams, ResponseParams);
+		}
+
+		InFlightSuspensionTraces.Add(Request);
+	}
+	QueuedSuspensionTraces.Reset();
+}
+
+void FChaosVehicleManager::PushPendingOutput(Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput>&& Output)
+{
+	if (NumPendingOutputs == PendingOutputs.Num())
+	{
+		// full, double the capacity and unwrap the existing entries so they start at zero again
+		TArray<Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput>> NewPendingOutputs;
+		NewPendingOutputs.SetNum(PendingOutputs.Num() * 2);
+		for (int32 OutputIdx = 0; OutputIdx < NumPendingOutputs; ++OutputIdx)
+		{
+			NewPendingOutputs[OutputIdx] = MoveTemp(GetPendingOutput(OutputIdx));
+		}
+		PendingOutputs = MoveTemp(NewPendingOutputs);
+		PendingOutputsHead = 0;
+	}
+
+	GetPendingOutput(NumPendingOutputs) = MoveTemp(Output);
+	NumPendingOutputs++;
+}
+
+void FChaosVehicleManager::PopPendingOutputs(int32 Count)
+{
+	check(Count <= NumPendingOutputs);
+
+	for (int32 OutputIdx = 0; OutputIdx < Count; ++OutputIdx)
+	{
+		// releases the output back to the solver, unless it has already been moved out
+		GetPendingOutput(OutputIdx).Reset();
+	}
+
+	PendingOutputsHead = (PendingOutputsHead + Count) & (PendingOutputs.Num() - 1);
+	NumPendingOutputs -= Count;
 }
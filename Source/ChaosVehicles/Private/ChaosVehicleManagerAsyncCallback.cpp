@@ -10,6 +10,79 @@
 extern FVehicleDebugParams GVehicleDebugParams;
 
 DECLARE_CYCLE_STAT(TEXT("AsyncCallback:OnPreSimulate_Internal"), STAT_AsyncCallback_OnPreSimulate, STATGROUP_ChaosVehicleManager);
+DECLARE_CYCLE_STAT(TEXT("AsyncCallback:BatchedQueries"), STAT_AsyncCallback_BatchedQueries, STATGROUP_ChaosVehicleManager);
+
+// pooled objects are never freed while the callback is alive, so these are also the pool high water marks
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumPooledVehicleInputs"), STAT_NumPooledVehicleInputs, STATGROUP_ChaosVehicleManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumPooledVehicleOutputs"), STAT_NumPooledVehicleOutputs, STATGROUP_ChaosVehicleManager);
+
+#if WITH_DEV_AUTOMATION_TESTS
+std::atomic<IChaosVehicleSimulationObserver*> IChaosVehicleSimulationObserver::Observer(nullptr);
+#endif
+
+FChaosVehicleManagerAsyncInput::~FChaosVehicleManagerAsyncInput()
+{
+	DEC_DWORD_STAT_BY(STAT_NumPooledVehicleInputs, VehicleInputs.Num() + FreeVehicleInputs.Num());
+}
+
+TUniquePtr<FChaosVehicleAsyncInput> FChaosVehicleManagerAsyncInput::AcquireVehicleInput()
+{
+	if (FreeVehicleInputs.Num() > 0)
+	{
+		return FreeVehicleInputs.Pop(false);
+	}
+
+	INC_DWORD_STAT(STAT_NumPooledVehicleInputs);
+	return MakeUnique<FChaosVehicleAsyncInput>();
+}
+
+FChaosVehicleManagerAsyncOutput::~FChaosVehicleManagerAsyncOutput()
+{
+	DEC_DWORD_STAT_BY(STAT_NumPooledVehicleOutputs, VehicleOutputs.Num() + FreeVehicleOutputs.Num());
+}
+
+TUniquePtr<FChaosVehicleAsyncOutput> FChaosVehicleManagerAsyncOutput::AcquireVehicleOutput()
+{
+	if (FreeVehicleOutputs.Num() > 0)
+	{
+		return FreeVehicleOutputs.Pop(false);
+	}
+
+	INC_DWORD_STAT(STAT_NumPooledVehicleOutputs);
+	return MakeUnique<FChaosVehicleAsyncOutput>();
+}
+
+void FVehicleOutputView::GetWheel(int32 WheelIdx, FWheelsOutput& OutWheel) const
+{
+	const FWheelsOutput& CurrentWheel = Current->Wheels[WheelIdx];
+
+	OutWheel.InContact = CurrentWheel.InContact;
+	OutWheel.SteeringAngle = Lerp(&FWheelsOutput::SteeringAngle, WheelIdx);
+	OutWheel.WheelRadius = Lerp(&FWheelsOutput::WheelRadius, WheelIdx);
+	OutWheel.AngularPosition = GetAngularPosition(WheelIdx);
+	OutWheel.AngularVelocity = Lerp(&FWheelsOutput::AngularVelocity, WheelIdx);
+	OutWheel.LateralAdhesiveLimit = Lerp(&FWheelsOutput::LateralAdhesiveLimit, WheelIdx);
+	OutWheel.LongitudinalAdhesiveLimit = Lerp(&FWheelsOutput::LongitudinalAdhesiveLimit, WheelIdx);
+
+	OutWheel.bIsSlipping = CurrentWheel.bIsSlipping;
+	OutWheel.SlipMagnitude = Lerp(&FWheelsOutput::SlipMagnitude, WheelIdx);
+	OutWheel.bIsSkidding = CurrentWheel.bIsSkidding;
+	OutWheel.SkidMagnitude = Lerp(&FWheelsOutput::SkidMagnitude, WheelIdx);
+	OutWheel.SkidNormal = Lerp(&FWheelsOutput::SkidNormal, WheelIdx);
+	OutWheel.SlipAngle = Lerp(&FWheelsOutput::SlipAngle, WheelIdx);
+
+	OutWheel.SuspensionOffset = Lerp(&FWheelsOutput::SuspensionOffset, WheelIdx);
+	OutWheel.SpringForce = Lerp(&FWheelsOutput::SpringForce, WheelIdx);
+	OutWheel.NormalizedSuspensionLength = Lerp(&FWheelsOutput::NormalizedSuspensionLength, WheelIdx);
+	OutWheel.DriveTorque = Lerp(&FWheelsOutput::DriveTorque, WheelIdx);
+	OutWheel.BrakeTorque = Lerp(&FWheelsOutput::BrakeTorque, WheelIdx);
+
+	OutWheel.bABSActivated = CurrentWheel.bABSActivated;
+	OutWheel.bBlockingHit = CurrentWheel.bBlockingHit;
+	OutWheel.ImpactPoint = Lerp(&FWheelsOutput::ImpactPoint, WheelIdx);
+	OutWheel.HitLocation = Lerp(&FWheelsOutput::HitLocation, WheelIdx);
+	OutWheel.PhysMaterial = CurrentWheel.PhysMaterial;
+}
 
 FName FChaosVehicleManagerAsyncCallback::GetFNameForStatId() const
 {
@@ -31,7 +104,7 @@ void FChaosVehicleManagerAsyncCallback::ProcessInputs_Internal(int32 PhysicsStep
 
 	for (const TUniquePtr<FChaosVehicleAsyncInput>& VehicleInput : AsyncInput->VehicleInputs)
 	{
-		UChaosVehicleSimulation* VehicleSim = VehicleInput->Vehicle->VehicleSimulationPT.Get();
+		UChaosVehicleSimulation* VehicleSim = VehicleInput->Simulation;
 
 		if (VehicleSim == nullptr || !VehicleInput->Vehicle->bUsingNetworkPhysicsPrediction)
 		{
@@ -76,9 +149,9 @@ void FChaosVehicleManagerAsyncCallback::OnPreSimulate_Internal()
 	const int32 NumVehicles = Input->VehicleInputs.Num();
 
 	UWorld* World = Input->World.Get();	//only safe to access for scene queries
-	if (World == nullptr || NumVehicles == 0)
+	if (World == nullptr)
 	{
-		//world is gone so don't bother, or nothing to simulate.
+		//world is gone so don't bother
 		return;
 	}
 
@@ -88,15 +161,67 @@ void FChaosVehicleManagerAsyncCallback::OnPreSimulate_Internal()
 		return;
 	}
 
+	// the output is produced even with nothing to simulate, it tells the game thread which inputs are no longer in use
 	FChaosVehicleManagerAsyncOutput& Output = GetProducerOutputData_Internal();
-	Output.VehicleOutputs.AddDefaulted(NumVehicles);
 	Output.Timestamp = Input->Timestamp;
+	if (NumVehicles == 0)
+	{
+		return;
+	}
+
+	Output.VehicleOutputs.Reserve(NumVehicles);
+	for (int32 Idx = 0; Idx < NumVehicles; ++Idx)
+	{
+		Output.VehicleOutputs.Add(Output.AcquireVehicleOutput());
+	}
 
 	const TArray<TUniquePtr<FChaosVehicleAsyncInput>>& InputVehiclesBatch = Input->VehicleInputs;
 	TArray<TUniquePtr<FChaosVehicleAsyncOutput>>& OutputVehiclesBatch = Output.VehicleOutputs;
 
+	bool ForceSingleThread = !GVehicleDebugParams.EnableMultithreading;
+
+	if (GVehicleDebugParams.BatchQueriesAcrossVehicles)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AsyncCallback_BatchedQueries);
+
+		QueriesPrepared.SetNumZeroed(NumVehicles, false);
+
+		// capture each vehicle's state in parallel, then gather all of the suspension traces so they can be resolved together
+		PhysicsParallelFor(NumVehicles, [this, World, DeltaTime, &InputVehiclesBatch](int32 Idx)
+			{
+				const FChaosVehicleAsyncInput& VehicleInput = *InputVehiclesBatch[Idx];
+				QueriesPrepared[Idx] = false;
+
+				if (VehicleInput.Proxy == nullptr || VehicleInput.Proxy->GetPhysicsThreadAPI() == nullptr)
+				{
+					return;
+				}
+
+				if (VehicleInput.Proxy->GetPhysicsThreadAPI()->ObjectState() != Chaos::EObjectStateType::Dynamic)
+				{
+					return;
+				}
+
+				QueriesPrepared[Idx] = VehicleInput.PrepareBatchedQueries(World, DeltaTime);
+			}, ForceSingleThread);
+
+		SuspensionQueries.Reset();
+		for (int32 Idx = 0; Idx < NumVehicles; ++Idx)
+		{
+			if (QueriesPrepared[Idx])
+			{
+				InputVehiclesBatch[Idx]->AddBatchedQueries(SuspensionQueries);
+			}
+		}
+
+		SuspensionQueries.Resolve(World, GVehicleDebugParams.QueryBatchCellSize, ForceSingleThread);
+	}
+
+	// forces only write to the vehicle's own body, so a vehicle that doesn't share its body can apply them as soon as it has simulated
+	FindForcesAppliedInParallel(InputVehiclesBatch);
+
 	// beware running the vehicle simulation in parallel, code must remain threadsafe
-	auto LambdaParallelUpdate = [World, DeltaTime, SimTime, &InputVehiclesBatch, &OutputVehiclesBatch](int32 Idx)
+	auto LambdaParallelUpdate = [this, World, DeltaTime, SimTime, &InputVehiclesBatch, &OutputVehiclesBatch](int32 Idx)
 	{
 		const FChaosVehicleAsyncInput& VehicleInput = *InputVehiclesBatch[Idx];
 
@@ -112,16 +237,36 @@ void FChaosVehicleManagerAsyncCallback::OnPreSimulate_Internal()
 		}
 
 		bool bWake = false;
-		OutputVehiclesBatch[Idx] = VehicleInput.Simulate(World, DeltaTime, SimTime, bWake);
+#if WITH_DEV_AUTOMATION_TESTS
+		IChaosVehicleSimulationObserver* Observer = IChaosVehicleSimulationObserver::Get();
+		if (Observer)
+		{
+			Observer->OnBeginSimulate();
+		}
+#endif
+
+		VehicleInput.Simulate(World, DeltaTime, SimTime, bWake, *OutputVehiclesBatch[Idx]);
+
+#if WITH_DEV_AUTOMATION_TESTS
+		if (Observer)
+		{
+			Observer->OnEndSimulate();
+		}
+#endif
+
+		if (ForcesAppliedInParallel[Idx])
+		{
+			VehicleInput.ApplyDeferredForces(Handle);
+		}
 	};
 
-	bool ForceSingleThread = !GVehicleDebugParams.EnableMultithreading;
 	PhysicsParallelFor(OutputVehiclesBatch.Num(), LambdaParallelUpdate, ForceSingleThread);
 
-	// Delayed application of forces - This is separate from Simulate because forces cannot be executed multi-threaded
-	for (const TUniquePtr<FChaosVehicleAsyncInput>& VehicleInput : InputVehiclesBatch)
+	// Delayed application of forces - This is separate from Simulate for vehicles sharing a body, their forces cannot be executed multi-threaded
+	for (int32 Idx = 0; Idx < NumVehicles; ++Idx)
 	{
-		if (VehicleInput.IsValid() && VehicleInput->Proxy)
+		const TUniquePtr<FChaosVehicleAsyncInput>& VehicleInput = InputVehiclesBatch[Idx];
+		if (!ForcesAppliedInParallel[Idx] && VehicleInput.IsValid() && VehicleInput->Proxy)
 		{
 			if (Chaos::FRigidBodyHandle_Internal* Handle = VehicleInput->Proxy->GetPhysicsThreadAPI())
 			{
@@ -131,34 +276,116 @@ void FChaosVehicleManagerAsyncCallback::OnPreSimulate_Internal()
 	}
 }
 
+void FChaosVehicleManagerAsyncCallback::FindForcesAppliedInParallel(const TArray<TUniquePtr<FChaosVehicleAsyncInput>>& InputVehiclesBatch)
+{
+	const int32 NumVehicles = InputVehiclesBatch.Num();
+	ForcesAppliedInParallel.Init(false, NumVehicles);
+
+	if (!GVehicleDebugParams.ParallelApplyForces)
+	{
+		return;
+	}
+
+	BodyHandles.Reset();
+	SharedBodyHandles.Reset();
+
+	for (const TUniquePtr<FChaosVehicleAsyncInput>& VehicleInput : InputVehiclesBatch)
+	{
+		if (VehicleInput.IsValid() && VehicleInput->Proxy)
+		{
+			if (const Chaos::FRigidBodyHandle_Internal* Handle = VehicleInput->Proxy->GetPhysicsThreadAPI())
+			{
+				bool bAlreadyInSet = false;
+				BodyHandles.Add(Handle, &bAlreadyInSet);
+				if (bAlreadyInSet)
+				{
+					SharedBodyHandles.Add(Handle);
+				}
+			}
+		}
+	}
+
+	for (int32 Idx = 0; Idx < NumVehicles; ++Idx)
+	{
+		const TUniquePtr<FChaosVehicleAsyncInput>& VehicleInput = InputVehiclesBatch[Idx];
+		if (VehicleInput.IsValid() && VehicleInput->Proxy)
+		{
+			const Chaos::FRigidBodyHandle_Internal* Handle = VehicleInput->Proxy->GetPhysicsThreadAPI();
+			ForcesAppliedInParallel[Idx] = Handle && !SharedBodyHandles.Contains(Handle);
+		}
+	}
+}
+
 TUniquePtr<FChaosVehicleAsyncOutput> FChaosVehicleAsyncInput::Simulate(UWorld* World, const float DeltaSeconds, const float TotalSeconds, bool& bWakeOut) const
 {
 	TUniquePtr<FChaosVehicleAsyncOutput> Output = MakeUnique<FChaosVehicleAsyncOutput>();
+	Simulate(World, DeltaSeconds, TotalSeconds, bWakeOut, *Output);
+	return MoveTemp(Output);
+}
 
+void FChaosVehicleAsyncInput::Simulate(UWorld* World, const float DeltaSeconds, const float TotalSeconds, bool& bWakeOut, FChaosVehicleAsyncOutput& Output) const
+{
 	//UE_LOG(LogChaos, Warning, TEXT("Vehicle Physics Thread Tick %f"), DeltaSeconds);
 
 	//support nullptr because it allows us to go wide on filling the async inputs
-	if (Proxy == nullptr)
+	//the simulation is the one the vehicle had when this input was filled, the manager keeps it alive until this step has run
+	if (Proxy == nullptr || Simulation == nullptr)
 	{
-		return Output;
+		return;
 	}
 
 	// We now have access to the physics representation of the chassis on the physics thread async tick
 	Chaos::FRigidBodyHandle_Internal* Handle = Proxy->GetPhysicsThreadAPI();
 
-	// FILL OUTPUT DATA HERE THAT WILL GET PASSED BACK TO THE GAME THREAD
-	Vehicle->VehicleSimulationPT->TickVehicle(World, DeltaSeconds, *this, *Output.Get(), Handle);
+	if (PhysicsInputs.bResetSimulation)
+	{
+		Simulation->ResetSimulation();
+	}
 
-	Output->bValid = true;
+	if (PhysicsInputs.TuningPatch)
+	{
+		Simulation->ApplyTuningPatch(*PhysicsInputs.TuningPatch);
+	}
 
-	return MoveTemp(Output);
+	for (const FVehicleWheelClassChange& WheelClassChange : PhysicsInputs.WheelClassChanges)
+	{
+		Simulation->InitializeWheel(WheelClassChange.WheelIndex, &WheelClassChange.SharedConfig->WheelConfig);
+		Simulation->InitializeSuspension(WheelClassChange.WheelIndex, &WheelClassChange.SharedConfig->SuspensionConfig);
+	}
+
+	// FILL OUTPUT DATA HERE THAT WILL GET PASSED BACK TO THE GAME THREAD
+	Simulation->TickVehicle(World, DeltaSeconds, *this, Output, Handle);
+
+	Output.bValid = true;
 }
 
 void FChaosVehicleAsyncInput::ApplyDeferredForces(Chaos::FRigidBodyHandle_Internal* RigidHandle) const
 {
 	check(Vehicle);
-	check(Vehicle->VehicleSimulationPT);
-	Vehicle->VehicleSimulationPT->ApplyDeferredForces(RigidHandle);
+	if (Simulation)
+	{
+		Simulation->ApplyDeferredForces(RigidHandle);
+	}
+}
+
+bool FChaosVehicleAsyncInput::PrepareBatchedQueries(UWorld* World, const float DeltaSeconds) const
+{
+	check(Vehicle);
+	if (Proxy == nullptr || Simulation == nullptr)
+	{
+		return false;
+	}
+
+	return Simulation->PrepareBatchedQueries(World, DeltaSeconds, *this, Proxy->GetPhysicsThreadAPI());
+}
+
+void FChaosVehicleAsyncInput::AddBatchedQueries(FSuspensionQueryBatch& QueryBatch) const
+{
+	check(Vehicle);
+	if (Simulation)
+	{
+		Simulation->AddBatchedQueries(*this, QueryBatch);
+	}
 }
 
 bool FNetworkVehicleInputs::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
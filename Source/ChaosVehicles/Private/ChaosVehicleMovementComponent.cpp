@@ -13,6 +13,7 @@
 #include "Engine/StaticMesh.h"
 #include "DrawDebugHelpers.h"
 #include "UObject/FrameworkObjectVersion.h"
+#include "UObject/UObjectIterator.h"
 #include "Net/UnrealNetwork.h"
 #include "VehicleAnimationInstance.h"
 #include "PhysicsEngine/PhysicsAsset.h"
@@ -71,6 +72,20 @@ FAutoConsoleVariableRef CVarChaosVehiclesDisableVehicleSleep(TEXT("p.Vehicle.Dis
 FAutoConsoleVariableRef CVarChaosVehiclesSetMaxMPH(TEXT("p.Vehicle.SetMaxMPH"), GVehicleDebugParams.SetMaxMPH, TEXT("Set a top speed in MPH (affects all vehicles)."));
 FAutoConsoleVariableRef CVarChaosVehiclesEnableMultithreading(TEXT("p.Vehicle.EnableMultithreading"), GVehicleDebugParams.EnableMultithreading, TEXT("Enable multi-threading of vehicle updates."));
 FAutoConsoleVariableRef CVarChaosVehiclesControlInputWakeTolerance(TEXT("p.Vehicle.ControlInputWakeTolerance"), GVehicleDebugParams.ControlInputWakeTolerance, TEXT("Set the control input wake tolerance."));
+FAutoConsoleVariableRef CVarChaosVehiclesEnableOutputViews(TEXT("p.Vehicle.EnableOutputViews"), GVehicleDebugParams.EnableOutputViews, TEXT("Enable/Disable reading wheel outputs through a view of the physics outputs instead of copying them every frame."));
+FAutoConsoleVariableRef CVarChaosVehiclesBatchQueriesAcrossVehicles(TEXT("p.Vehicle.BatchQueriesAcrossVehicles"), GVehicleDebugParams.BatchQueriesAcrossVehicles, TEXT("Enable/Disable gathering the suspension traces of all vehicles and resolving them together before the vehicles are simulated."));
+FAutoConsoleVariableRef CVarChaosVehiclesQueryBatchCellSize(TEXT("p.Vehicle.QueryBatchCellSize"), GVehicleDebugParams.QueryBatchCellSize, TEXT("Set the size of the spatial cells that share an overlap test (only valid when BatchQueriesAcrossVehicles enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesCurveLUTResolution(TEXT("p.Vehicle.CurveLUTResolution"), GVehicleDebugParams.CurveLUTResolution, TEXT("Set the number of intervals the engine torque and input curves are sampled at when baked."), FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+	{
+		// the tables are only read on the game thread, which is where console variables change
+		for (TObjectIterator<UChaosVehicleMovementComponent> It; It && UObjectInitialized(); ++It)
+		{
+			It->BakeCurves();
+		}
+	}));
+FAutoConsoleVariableRef CVarChaosVehiclesMaxParkedVehicles(TEXT("p.Vehicle.MaxParkedVehicles"), GVehicleDebugParams.MaxParkedVehicles, TEXT("Set the number of simulations the vehicle manager keeps for reuse per vehicle class (only for vehicles with PoolSimulation enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesAccumulateForces(TEXT("p.Vehicle.AccumulateForces"), GVehicleDebugParams.AccumulateForces, TEXT("Enable/Disable summing each vehicle's forces into a single net force and torque before applying them, rather than applying every force individually."));
+FAutoConsoleVariableRef CVarChaosVehiclesParallelApplyForces(TEXT("p.Vehicle.ParallelApplyForces"), GVehicleDebugParams.ParallelApplyForces, TEXT("Enable/Disable applying each vehicle's forces in the parallel vehicle update, vehicles sharing a body always apply theirs afterwards on one thread."));
 
 
 void FVehicleState::CaptureState(const FBodyInstance* TargetInstance, float GravityZ, float DeltaTime)
@@ -93,6 +108,10 @@ void FVehicleState::CaptureState(const FBodyInstance* TargetInstance, float Grav
 		LocalGForce = LocalAcceleration / FMath::Abs(GravityZ);
 		LastFrameVehicleLocalVelocity = VehicleLocalVelocity;
 
+		LocalFrameRotation = FQuat4f(VehicleWorldTransform.GetRotation());
+		LocalAngularVelocity = LocalFrameRotation.UnrotateVector(FVector3f(VehicleWorldAngularVelocity));
+		LocalCOM = FVector3f(VehicleWorldTransform.InverseTransformPosition(VehicleWorldCOM));
+
 		ForwardSpeed = FVector::DotProduct(VehicleWorldVelocity, VehicleForwardAxis);
 		ForwardsAcceleration = LocalAcceleration.X;
 	}
@@ -126,6 +145,11 @@ void FVehicleState::CaptureState(const Chaos::FRigidBodyHandle_Internal* Handle,
 #endif
 		LastFrameVehicleLocalVelocity = VehicleLocalVelocity;
 
+		// the handle's center of mass is already relative to the chassis
+		LocalFrameRotation = FQuat4f(Handle->R());
+		LocalAngularVelocity = LocalFrameRotation.UnrotateVector(FVector3f(VehicleWorldAngularVelocity));
+		LocalCOM = FVector3f(Handle->CenterOfMass());
+
 		ForwardSpeed = FVector::DotProduct(VehicleWorldVelocity, VehicleForwardAxis);
 		ForwardsAcceleration = LocalAcceleration.X;
 
@@ -141,6 +165,7 @@ void UChaosVehicleSimulation::TickVehicle(UWorld* WorldIn, float DeltaTime, cons
 {
 	World = WorldIn;
 	RigidHandle = Handle;
+	DeferredForces.SetAccumulate(GVehicleDebugParams.AccumulateForces);
 
 	// movement updates and replication
 	if (World && RigidHandle)
@@ -310,10 +335,8 @@ void UChaosVehicleSimulation::ApplyAerofoilForces(float DeltaTime)
 	if (GVehicleDebugParams.DisableAerofoils || RigidHandle == nullptr)
 		return;
 
-	TArray<FVector> VelocityLocal;
-	TArray<FVector> VelocityWorld;
-	VelocityLocal.SetNum(PVehicle->Aerofoils.Num());
-	VelocityWorld.SetNum(PVehicle->Aerofoils.Num());
+	// sized when the vehicle is created, this only allocates if aerofoils are added afterwards
+	AerofoilLocalVelocity.SetNum(PVehicle->Aerofoils.Num(), false);
 
 	float Altitude = VehicleState.VehicleWorldTransform.GetLocation().Z;
 
@@ -321,15 +344,15 @@ void UChaosVehicleSimulation::ApplyAerofoilForces(float DeltaTime)
 	for (int AerofoilIdx = 0; AerofoilIdx < PVehicle->Aerofoils.Num(); AerofoilIdx++)
 	{
 		FVector WorldLocation = VehicleState.VehicleWorldTransform.TransformPosition(PVehicle->GetAerofoil(AerofoilIdx).Setup().Offset * Chaos::MToCmScaling());
-		VelocityWorld[AerofoilIdx] = GetWorldVelocityAtPoint(RigidHandle, WorldLocation);
-		VelocityLocal[AerofoilIdx] = VehicleState.VehicleWorldTransform.InverseTransformVector(VelocityWorld[AerofoilIdx]);
+		const FVector VelocityWorld = GetWorldVelocityAtPoint(RigidHandle, WorldLocation);
+		AerofoilLocalVelocity[AerofoilIdx] = VehicleState.VehicleWorldTransform.InverseTransformVector(VelocityWorld);
 	}
 
 	for (int AerofoilIdx = 0; AerofoilIdx < PVehicle->Aerofoils.Num(); AerofoilIdx++)
 	{
 		Chaos::FAerofoil& Aerofoil = PVehicle->GetAerofoil(AerofoilIdx);
 
-		FVector LocalForce = Aerofoil.GetForce(VehicleState.VehicleWorldTransform, VelocityLocal[AerofoilIdx] * Chaos::CmToMScaling(), Chaos::CmToM(Altitude), DeltaTime);
+		FVector LocalForce = Aerofoil.GetForce(VehicleState.VehicleWorldTransform, AerofoilLocalVelocity[AerofoilIdx] * Chaos::CmToMScaling(), Chaos::CmToM(Altitude), DeltaTime);
 
 		FVector WorldForce = VehicleState.VehicleWorldTransform.TransformVector(LocalForce);
 		FVector WorldLocation = VehicleState.VehicleWorldTransform.TransformPosition(Aerofoil.GetCenterOfLiftOffset() * Chaos::MToCmScaling());
@@ -576,18 +599,146 @@ void UChaosVehicleSimulation::AddTorqueInRadians(const FVector& Torque, bool bAl
 
 void UChaosVehicleSimulation::InitializeWheel(int WheelIndex, const Chaos::FSimpleWheelConfig* InWheelSetup)
 {
-	if (PVehicle->IsValid() && InWheelSetup && WheelIndex < PVehicle->Wheels.Num())
+	if (PVehicle->IsValid() && InWheelSetup && WheelIndex < PVehicle->Wheels.Num() && WheelConfigs.IsValidIndex(WheelIndex))
 	{
-		PVehicle->Wheels[WheelIndex].SetupPtr = InWheelSetup;
+		WheelConfigs[WheelIndex] = *InWheelSetup;
+		PVehicle->Wheels[WheelIndex].SetupPtr = &WheelConfigs[WheelIndex];
 		PVehicle->Wheels[WheelIndex].SetWheelRadius(InWheelSetup->WheelRadius);
 	}
 }
 
 void UChaosVehicleSimulation::InitializeSuspension(int WheelIndex, const Chaos::FSimpleSuspensionConfig* InSuspensionSetup)
 {
-	if (PVehicle->IsValid() && InSuspensionSetup && WheelIndex < PVehicle->Suspension.Num())
+	if (PVehicle->IsValid() && InSuspensionSetup && WheelIndex < PVehicle->Suspension.Num() && SuspensionConfigs.IsValidIndex(WheelIndex))
 	{
-		PVehicle->Suspension[WheelIndex].SetupPtr = InSuspensionSetup;
+		SuspensionConfigs[WheelIndex] = *InSuspensionSetup;
+		PVehicle->Suspension[WheelIndex].SetupPtr = &SuspensionConfigs[WheelIndex];
+	}
+}
+
+TUniquePtr<UChaosVehicleSimulation> UChaosVehicleSimulation::Clone() const
+{
+	TUniquePtr<UChaosVehicleSimulation> Simulation = MakeUnique<UChaosVehicleSimulation>();
+	CloneVehicle(*Simulation);
+	return Simulation;
+}
+
+void UChaosVehicleSimulation::CloneVehicle(UChaosVehicleSimulation& Other) const
+{
+	check(PVehicle);
+
+	Other.PVehicle = MakeUnique<Chaos::FSimpleWheeledVehicle>(*PVehicle);
+	Other.AerofoilLocalVelocity.SetNum(PVehicle->Aerofoils.Num());
+	Other.WheelConfigs = WheelConfigs;
+	Other.SuspensionConfigs = SuspensionConfigs;
+
+	// the copied wheels and suspension still point at our setups
+	for (int WheelIdx = 0; WheelIdx < Other.PVehicle->Wheels.Num() && WheelIdx < Other.WheelConfigs.Num(); WheelIdx++)
+	{
+		Other.PVehicle->Wheels[WheelIdx].SetupPtr = &Other.WheelConfigs[WheelIdx];
+	}
+
+	for (int WheelIdx = 0; WheelIdx < Other.PVehicle->Suspension.Num() && WheelIdx < Other.SuspensionConfigs.Num(); WheelIdx++)
+	{
+		Other.PVehicle->Suspension[WheelIdx].SetupPtr = &Other.SuspensionConfigs[WheelIdx];
+	}
+}
+
+namespace ChaosVehicleReset
+{
+	/** Rebuild each system from its setup, dropping its dynamic state without reallocating */
+	template <typename TSystem>
+	void ResetSystems(TArray<TSystem>& Systems)
+	{
+		for (TSystem& System : Systems)
+		{
+			System = TSystem(&System.Setup());
+		}
+	}
+}
+
+void UChaosVehicleSimulation::ResetSimulation()
+{
+	using namespace ChaosVehicleReset;
+
+	VehicleState = FVehicleState();
+	VehicleInputs = FControlInputs();
+	DeferredForces.Reset();
+
+	if (!PVehicle.IsValid())
+	{
+		return;
+	}
+
+	ResetSystems(PVehicle->Engine);
+	ResetSystems(PVehicle->Transmission);
+	ResetSystems(PVehicle->Differential);
+	ResetSystems(PVehicle->Steering);
+	ResetSystems(PVehicle->Aerodynamics);
+	ResetSystems(PVehicle->Aerofoils);
+	ResetSystems(PVehicle->Thrusters);
+	ResetSystems(PVehicle->TorqueControlSim);
+	ResetSystems(PVehicle->TargetRotationControlSim);
+	ResetSystems(PVehicle->StabilizeControlSim);
+
+	// the wheels and suspension also carry values from the vehicle setup that aren't in their own setups
+	for (int WheelIdx = 0; WheelIdx < PVehicle->Wheels.Num(); WheelIdx++)
+	{
+		Chaos::FSimpleWheelSim& Wheel = PVehicle->Wheels[WheelIdx];
+		const bool bEngineEnabled = Wheel.EngineEnabled;
+
+		Wheel = Chaos::FSimpleWheelSim(&Wheel.Setup());
+		Wheel.SetWheelIndex(WheelIdx);
+		Wheel.SetWheelRadius(Wheel.Setup().WheelRadius);
+		Wheel.EngineEnabled = bEngineEnabled;
+	}
+
+	for (int WheelIdx = 0; WheelIdx < PVehicle->Suspension.Num(); WheelIdx++)
+	{
+		Chaos::FSimpleSuspensionSim& Suspension = PVehicle->Suspension[WheelIdx];
+		const FVector RestingPosition = Suspension.GetLocalRestingPosition();
+
+		Suspension = Chaos::FSimpleSuspensionSim(&Suspension.Setup());
+		Suspension.SetSpringIndex(WheelIdx);
+		Suspension.SetLocalRestingPosition(RestingPosition);
+	}
+}
+
+void UChaosVehicleSimulation::ApplyTuningPatch(const FVehicleTuningPatch& Patch)
+{
+	if (!PVehicle.IsValid())
+	{
+		return;
+	}
+
+	if (PVehicle->Aerodynamics.Num() > 0)
+	{
+		PVehicle->Aerodynamics[0].AccessSetup() = Patch.Aerodynamics;
+	}
+
+	for (int AerofoilIdx = 0; AerofoilIdx < PVehicle->Aerofoils.Num() && AerofoilIdx < Patch.Aerofoils.Num(); AerofoilIdx++)
+	{
+		PVehicle->Aerofoils[AerofoilIdx].AccessSetup() = Patch.Aerofoils[AerofoilIdx];
+	}
+
+	for (int ThrusterIdx = 0; ThrusterIdx < PVehicle->Thrusters.Num() && ThrusterIdx < Patch.Thrusters.Num(); ThrusterIdx++)
+	{
+		PVehicle->Thrusters[ThrusterIdx].AccessSetup() = Patch.Thrusters[ThrusterIdx];
+	}
+
+	if (PVehicle->TorqueControlSim.Num() > 0)
+	{
+		PVehicle->TorqueControlSim[0].AccessSetup() = Patch.TorqueControl;
+	}
+
+	if (PVehicle->TargetRotationControlSim.Num() > 0)
+	{
+		PVehicle->TargetRotationControlSim[0].AccessSetup() = Patch.TargetRotationControl;
+	}
+
+	if (PVehicle->StabilizeControlSim.Num() > 0)
+	{
+		PVehicle->StabilizeControlSim[0].AccessSetup() = Patch.StabilizeControl;
 	}
 }
 
@@ -617,6 +768,11 @@ UChaosVehicleMovementComponent::UChaosVehicleMovementComponent(const FObjectInit
 
 	PrevSteeringInput = 0.0f;
 	PrevReplicatedSteeringInput = 0.0f;
+	AwakeVehicleIdx = INDEX_NONE;
+	bPoolSimulation = false;
+	bVehicleSetupModified = false;
+	bPendingSimulationReset = false;
+	bForcedWakeEvents = false;
 
 	bRequiresControllerForInputs = true;
 	IdleBrakeInput = 0.0f;
@@ -668,14 +824,51 @@ void UChaosVehicleMovementComponent::Serialize(FArchive& Ar)
 	// Custom serialization goes here...
 }
 
+void UChaosVehicleMovementComponent::PostLoad()
+{
+	Super::PostLoad();
+
+	BakeCurves();
+}
+
 #if WITH_EDITOR
 void UChaosVehicleMovementComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-	// Trigger a runtime rebuild of the Chaos vehicle
-	FChaosVehicleManager::VehicleSetupTag++;
+	if (RequiresVehicleRebuild(PropertyChangedEvent))
+	{
+		// Trigger a runtime rebuild of the Chaos vehicle
+		FChaosVehicleManager::VehicleSetupTag++;
+	}
+	else
+	{
+		// Only the setups changed, patch them into the running vehicles built from this component
+		FChaosVehicleManager::NotifyTuningChanged(this);
+	}
+
+	BakeCurves();
 
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
+
+bool UChaosVehicleMovementComponent::RequiresVehicleRebuild(const FPropertyChangedEvent& PropertyChangedEvent) const
+{
+	// adding or removing entries changes the number of vehicle systems
+	if (PropertyChangedEvent.ChangeType & (EPropertyChangeType::ArrayAdd | EPropertyChangeType::ArrayRemove | EPropertyChangeType::ArrayClear | EPropertyChangeType::ArrayMove | EPropertyChangeType::Duplicate))
+	{
+		return true;
+	}
+
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+
+	return PropertyName == NAME_None
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, Aerofoils)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, Thrusters)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, Mass)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, bEnableCenterOfMassOverride)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, CenterOfMassOverride)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, InertiaTensorScale)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosVehicleMovementComponent, bPoolSimulation);
+}
 #endif // WITH_EDITOR
 
 void UChaosVehicleMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
@@ -750,6 +943,10 @@ void UChaosVehicleMovementComponent::OnCreatePhysicsState()
 	Super::OnCreatePhysicsState();
 
 	VehicleSetupTag = FChaosVehicleManager::VehicleSetupTag;
+	VehicleTuningTag = FChaosVehicleManager::VehicleTuningTag;
+	PendingTuningPatch.Reset();
+	PendingWheelClassChanges.Reset();
+	bPendingSimulationReset = false;
 
 	// only create Physics vehicle in game
 	UWorld* World = GetWorld();
@@ -766,6 +963,14 @@ void UChaosVehicleMovementComponent::OnCreatePhysicsState()
 				{
 					FChaosVehicleManager* VehicleManager = FChaosVehicleManager::GetVehicleManagerFromScene(PhysScene);
 					VehicleManager->AddVehicle(this);
+
+					// sleeping vehicles are not ticked, so rely on the physics wake event to bring them back
+					if (UpdatedPrimitive)
+					{
+						bForcedWakeEvents = !UpdatedPrimitive->BodyInstance.bGenerateWakeEvents;
+						UpdatedPrimitive->BodyInstance.bGenerateWakeEvents = true;
+						UpdatedPrimitive->OnComponentWake.AddUniqueDynamic(this, &UChaosVehicleMovementComponent::OnBodyWake);
+					}
 				}
 			}
 			if (bUsingNetworkPhysicsPrediction)
@@ -792,8 +997,27 @@ void UChaosVehicleMovementComponent::OnDestroyPhysicsState()
 
 	if (PVehicleOutput.IsValid())
 	{
+		if (UpdatedPrimitive)
+		{
+			UpdatedPrimitive->OnComponentWake.RemoveDynamic(this, &UChaosVehicleMovementComponent::OnBodyWake);
+
+			// leave the body as the user set it up
+			if (bForcedWakeEvents)
+			{
+				UpdatedPrimitive->BodyInstance.bGenerateWakeEvents = false;
+				bForcedWakeEvents = false;
+			}
+		}
+
 		FChaosVehicleManager* VehicleManager = FChaosVehicleManager::GetVehicleManagerFromScene(GetWorld()->GetPhysicsScene());
-		VehicleManager->RemoveVehicle(this);
+		if (CanParkVehicle())
+		{
+			VehicleManager->ParkVehicle(this);
+		}
+		else
+		{
+			VehicleManager->RemoveVehicle(this);
+		}
 		PVehicleOutput.Reset(nullptr);
 
 		if (UpdatedComponent)
@@ -836,11 +1060,18 @@ void UChaosVehicleMovementComponent::PreTickGT(float DeltaTime)
 	{
 		ProcessSleeping(VehicleSimulationPT->VehicleInputs);
 	}
+}
 
+void UChaosVehicleMovementComponent::UpdateSetupChanges()
+{
 	if (VehicleSetupTag != FChaosVehicleManager::VehicleSetupTag)
 	{
 		RecreatePhysicsState();
 	}
+	else if (VehicleTuningTag != FChaosVehicleManager::VehicleTuningTag)
+	{
+		UpdateTuning();
+	}
 }
 
 void UChaosVehicleMovementComponent::StopMovementImmediately()
@@ -870,12 +1101,16 @@ void UChaosVehicleMovementComponent::StopMovementImmediately()
 
 void UChaosVehicleMovementComponent::SetThrottleInput(float Throttle)
 {
-	RawThrottleInput = FMath::Clamp(Throttle, -1.0f, 1.0f);
+	const float NewThrottleInput = FMath::Clamp(Throttle, -1.0f, 1.0f);
+	WakeOnControlInput(NewThrottleInput, RawThrottleInput);
+	RawThrottleInput = NewThrottleInput;
 }
 
 void UChaosVehicleMovementComponent::IncreaseThrottleInput(float ThrottleDelta)
 {
-	RawThrottleInput = FMath::Clamp(RawThrottleInput + ThrottleDelta, 0.f, 1.0f);
+	const float NewThrottleInput = FMath::Clamp(RawThrottleInput + ThrottleDelta, 0.f, 1.0f);
+	WakeOnControlInput(NewThrottleInput, RawThrottleInput);
+	RawThrottleInput = NewThrottleInput;
 }
 
 void UChaosVehicleMovementComponent::DecreaseThrottleInput(float ThrottleDelta)
@@ -885,27 +1120,37 @@ void UChaosVehicleMovementComponent::DecreaseThrottleInput(float ThrottleDelta)
 
 void UChaosVehicleMovementComponent::SetBrakeInput(float Brake)
 {
-	RawBrakeInput = FMath::Clamp(Brake, -1.0f, 1.0f);
+	const float NewBrakeInput = FMath::Clamp(Brake, -1.0f, 1.0f);
+	WakeOnControlInput(NewBrakeInput, RawBrakeInput);
+	RawBrakeInput = NewBrakeInput;
 }
 
 void UChaosVehicleMovementComponent::SetSteeringInput(float Steering)
 {
-	RawSteeringInput = FMath::Clamp(Steering, -1.0f, 1.0f);
+	const float NewSteeringInput = FMath::Clamp(Steering, -1.0f, 1.0f);
+	WakeOnControlInput(NewSteeringInput, RawSteeringInput);
+	RawSteeringInput = NewSteeringInput;
 }
 
 void UChaosVehicleMovementComponent::SetPitchInput(float Pitch)
 {
-	RawPitchInput = FMath::Clamp(Pitch, -1.0f, 1.0f);
+	const float NewPitchInput = FMath::Clamp(Pitch, -1.0f, 1.0f);
+	WakeOnControlInput(NewPitchInput, RawPitchInput);
+	RawPitchInput = NewPitchInput;
 }
 
 void UChaosVehicleMovementComponent::SetRollInput(float Roll)
 {
-	RawRollInput = FMath::Clamp(Roll, -1.0f, 1.0f);
+	const float NewRollInput = FMath::Clamp(Roll, -1.0f, 1.0f);
+	WakeOnControlInput(NewRollInput, RawRollInput);
+	RawRollInput = NewRollInput;
 }
 
 void UChaosVehicleMovementComponent::SetYawInput(float Yaw)
 {
-	RawYawInput = FMath::Clamp(Yaw, -1.0f, 1.0f);
+	const float NewYawInput = FMath::Clamp(Yaw, -1.0f, 1.0f);
+	WakeOnControlInput(NewYawInput, RawYawInput);
+	RawYawInput = NewYawInput;
 }
 
 void UChaosVehicleMovementComponent::SetHandbrakeInput(bool bNewHandbrake)
@@ -924,12 +1169,71 @@ void UChaosVehicleMovementComponent::SetSleeping(bool bEnableSleep)
 	if (bEnableSleep)
 	{
 		PutAllEnabledRigidBodiesToSleep();
-		VehicleState.bSleeping = true;
+		SetSleepingState(true);
 	}
 	else
 	{
 		WakeAllEnabledRigidBodies();
-		VehicleState.bSleeping = false;
+		SetSleepingState(false);
+	}
+}
+
+void UChaosVehicleMovementComponent::SetSleepingState(bool bInSleeping)
+{
+	if (VehicleState.bSleeping == bInSleeping)
+	{
+		return;
+	}
+
+	VehicleState.bSleeping = bInSleeping;
+
+	// Vehicles using network physics prediction receive their inputs on the physics thread, so they are always kept in the awake batch
+	if (VehicleHandle.IsValid() && (!bInSleeping || !bUsingNetworkPhysicsPrediction))
+	{
+		if (FChaosVehicleManager* VehicleManager = FChaosVehicleManager::GetVehicleManagerFromScene(GetWorld()->GetPhysicsScene()))
+		{
+			VehicleManager->SetVehicleAwake(this, !bInSleeping);
+		}
+	}
+
+	if (bInSleeping)
+	{
+		// outputs that were in flight will never be consumed
+		ResetOutputsWaitingOn();
+
+		// the outputs being viewed are released once the manager no longer updates this vehicle
+		MaterializeOutputView();
+	}
+}
+
+void UChaosVehicleMovementComponent::MaterializeOutputView()
+{
+	if (OutputView.IsValid() && PVehicleOutput)
+	{
+		for (int32 WheelIdx = 0; WheelIdx < OutputView.NumWheels(); WheelIdx++)
+		{
+			OutputView.GetWheel(WheelIdx, PVehicleOutput->Wheels[WheelIdx]);
+		}
+	}
+
+	OutputView = FVehicleOutputView();
+}
+
+void UChaosVehicleMovementComponent::WakeOnControlInput(float NewInput, float OldInput)
+{
+	if (VehicleState.bSleeping && FMath::Abs(NewInput - OldInput) >= GVehicleDebugParams.ControlInputWakeTolerance)
+	{
+		VehicleState.SleepCounter = 0;
+		SetSleeping(false);
+	}
+}
+
+void UChaosVehicleMovementComponent::OnBodyWake(UPrimitiveComponent* WakingComponent, FName BoneName)
+{
+	if (VehicleState.bSleeping)
+	{
+		VehicleState.SleepCounter = 0;
+		SetSleepingState(false);
 	}
 }
 
@@ -1155,9 +1459,10 @@ void UChaosVehicleMovementComponent::UpdateState(float DeltaTime)
 	int NumWheels = 0;
 	if (PVehicleOutput)
 	{
-		for (int WheelIdx = 0; WheelIdx < PVehicleOutput->Wheels.Num(); WheelIdx++)
+		const FVehicleOutputView View = GetOutputView();
+		for (int WheelIdx = 0; WheelIdx < View.NumWheels(); WheelIdx++)
 		{
-			if (PVehicleOutput->Wheels[WheelIdx].InContact)
+			if (View.GetInContact(WheelIdx))
 			{
 				VehicleState.NumWheelsOnGround++;
 			}
@@ -1251,7 +1556,7 @@ void UChaosVehicleMovementComponent::ProcessSleeping(const FControlInputs& Contr
 	if (TargetInstance)
 	{
 		bool PrevSleeping = VehicleState.bSleeping;
-		VehicleState.bSleeping = !TargetInstance->IsInstanceAwake();
+		SetSleepingState(!TargetInstance->IsInstanceAwake());
 
 		// The physics system has woken vehicle up due to a collision or something
 		if (PrevSleeping && !VehicleState.bSleeping)
@@ -1287,7 +1592,6 @@ void UChaosVehicleMovementComponent::ProcessSleeping(const FControlInputs& Contr
 		// Wake if control input pressed
 		if ((VehicleState.bSleeping && bControlInputPressed) || GVehicleDebugParams.DisableVehicleSleep)
 		{
-			VehicleState.bSleeping = false;
 			VehicleState.SleepCounter = 0;
 			SetSleeping(false);
 		}
@@ -1302,7 +1606,6 @@ void UChaosVehicleMovementComponent::ProcessSleeping(const FControlInputs& Contr
 				}
 				else
 				{
-					VehicleState.bSleeping = true;
 					SetSleeping(true);
 				}
 			}
@@ -1320,6 +1623,14 @@ bool UChaosVehicleMovementComponent::ServerUpdateState_Validate(float InSteering
 void UChaosVehicleMovementComponent::ServerUpdateState_Implementation(float InSteeringInput, float InThrottleInput, float InBrakeInput
 	, float InHandbrakeInput, int32 InCurrentGear, float InRollInput, float InPitchInput, float InYawInput)
 {
+	// sleeping vehicles are not ticked so wake here rather than waiting on ProcessSleeping
+	WakeOnControlInput(InThrottleInput, ReplicatedState.ThrottleInput);
+	WakeOnControlInput(InBrakeInput, ReplicatedState.BrakeInput);
+	WakeOnControlInput(InSteeringInput, ReplicatedState.SteeringInput);
+	WakeOnControlInput(InRollInput, ReplicatedState.RollInput);
+	WakeOnControlInput(InPitchInput, ReplicatedState.PitchInput);
+	WakeOnControlInput(InYawInput, ReplicatedState.YawInput);
+
 	SteeringInput = InSteeringInput;
 	ThrottleInput = InThrottleInput;
 	BrakeInput = InBrakeInput;
@@ -1437,12 +1748,13 @@ FVector UChaosVehicleMovementComponent::LocateBoneOffset(const FName InBoneName,
 void UChaosVehicleMovementComponent::CreateVehicle()
 {
 	ComputeConstants();
+	BakeCurves();
 
 	{
 		if (CanCreateVehicle())
 		{
 			check(UpdatedComponent);
-			if (ensure(UpdatedPrimitive != nullptr))
+			if (ensure(UpdatedPrimitive != nullptr) && !TakeParkedVehicle())
 			{
 				TUniquePtr<Chaos::FSimpleWheeledVehicle> PVehicle = CreatePhysicsVehicle();
 
@@ -1457,6 +1769,14 @@ void UChaosVehicleMovementComponent::CreateVehicle()
 				// Physics thread simulation class will now take ownership of the PVehicle pointer, we cannot safely use it anymore from the game thread
 				VehicleSimulationPT->Init(PVehicle);
 
+				if (bPoolSimulation)
+				{
+					// the physics thread hasn't seen the simulation yet, so this is the only safe time to copy it for prewarming
+					if (FChaosVehicleManager* VehicleManager = FChaosVehicleManager::GetVehicleManagerFromScene(GetWorld()->GetPhysicsScene()))
+					{
+						VehicleManager->CaptureVehicleTemplate(this);
+					}
+				}
 			}
 
 			VehicleState.CaptureState(GetBodyInstance(), GetGravityZ(), 0.01667f);
@@ -1487,6 +1807,138 @@ void UChaosVehicleMovementComponent::PostSetupVehicle()
 {
 }
 
+bool UChaosVehicleMovementComponent::TakeParkedVehicle()
+{
+	if (!bPoolSimulation)
+	{
+		return false;
+	}
+
+	FChaosVehicleManager* VehicleManager = FChaosVehicleManager::GetVehicleManagerFromScene(GetWorld()->GetPhysicsScene());
+	if (VehicleManager == nullptr)
+	{
+		return false;
+	}
+
+	TUniquePtr<UChaosVehicleSimulation> Simulation = VehicleManager->TakeParkedVehicle(this);
+	if (!Simulation.IsValid())
+	{
+		return false;
+	}
+
+	check(Simulation->PVehicle);
+	PVehicleOutput = MakeUnique<FPhysicsVehicleOutput>();	// create physics output container
+
+	if (!RebindVehicle(*Simulation->PVehicle))
+	{
+		// drop it and build our own
+		PVehicleOutput.Reset(nullptr);
+		return false;
+	}
+
+	// the previous vehicle's constraints went with it
+	TArray<FPhysicsConstraintHandle> NoConstraintHandles;
+	Simulation->UpdateConstraintHandles(NoConstraintHandles);
+	Simulation->ResetSimulation();
+	VehicleSimulationPT = MoveTemp(Simulation);
+	bVehicleSetupModified = false;
+
+	PostSetupVehicle();
+	return true;
+}
+
+bool UChaosVehicleMovementComponent::RebindVehicle(Chaos::FSimpleWheeledVehicle& PVehicle)
+{
+	if (PVehicle.Aerodynamics.Num() != 1 || PVehicle.Aerofoils.Num() != Aerofoils.Num() || PVehicle.Thrusters.Num() != Thrusters.Num())
+	{
+		return false;
+	}
+
+	PVehicle.Aerodynamics[0].SetupPtr = &GetAerodynamicsConfig();
+
+	for (int AerofoilIdx = 0; AerofoilIdx < Aerofoils.Num(); AerofoilIdx++)
+	{
+		PVehicle.Aerofoils[AerofoilIdx].SetupPtr = &Aerofoils[AerofoilIdx].GetPhysicsAerofoilConfig(*this);
+	}
+
+	for (int ThrusterIdx = 0; ThrusterIdx < Thrusters.Num(); ThrusterIdx++)
+	{
+		PVehicle.Thrusters[ThrusterIdx].SetupPtr = &Thrusters[ThrusterIdx].GetPhysicsThrusterConfig(*this);
+	}
+
+	return true;
+}
+
+bool UChaosVehicleMovementComponent::CanParkVehicle() const
+{
+	return bPoolSimulation && !bVehicleSetupModified && VehicleSimulationPT.IsValid() && VehicleSetupTag == FChaosVehicleManager::VehicleSetupTag;
+}
+
+void UChaosVehicleMovementComponent::UpdateTuning()
+{
+	if (VehicleSimulationPT && IsTuningChanged(VehicleTuningTag))
+	{
+		// the edit may have come from an archetype, so our curves could be out of date too
+		BakeCurves();
+		PendingTuningPatch = CreateTuningPatch();
+	}
+
+	VehicleTuningTag = FChaosVehicleManager::VehicleTuningTag;
+}
+
+bool UChaosVehicleMovementComponent::IsTuningChanged(uint32 SinceTag) const
+{
+	return FChaosVehicleManager::HasTuningChanged(this, SinceTag) || FChaosVehicleManager::HasTuningChanged(GetArchetype(), SinceTag);
+}
+
+TSharedPtr<FVehicleTuningPatch, ESPMode::ThreadSafe> UChaosVehicleMovementComponent::CreateTuningPatch()
+{
+	TSharedPtr<FVehicleTuningPatch, ESPMode::ThreadSafe> Patch = MakeShared<FVehicleTuningPatch, ESPMode::ThreadSafe>();
+	FillTuningPatch(*Patch);
+	return Patch;
+}
+
+void UChaosVehicleMovementComponent::FillTuningPatch(FVehicleTuningPatch& Patch)
+{
+	ComputeConstants();
+	FillAerodynamicsSetup(Patch.Aerodynamics);
+
+	// the configs fill their physics setup in place, which the physics thread is reading, so fill copies
+	Patch.Aerofoils.Reset(Aerofoils.Num());
+	for (const FVehicleAerofoilConfig& AerofoilSetup : Aerofoils)
+	{
+		FVehicleAerofoilConfig AerofoilCopy = AerofoilSetup;
+		Patch.Aerofoils.Add(AerofoilCopy.GetPhysicsAerofoilConfig(*this));
+	}
+
+	Patch.Thrusters.Reset(Thrusters.Num());
+	for (const FVehicleThrustConfig& ThrustSetup : Thrusters)
+	{
+		FVehicleThrustConfig ThrustCopy = ThrustSetup;
+		Patch.Thrusters.Add(ThrustCopy.GetPhysicsThrusterConfig(*this));
+	}
+
+	FVehicleTorqueControlConfig TorqueControlCopy = TorqueControl;
+	Patch.TorqueControl = TorqueControlCopy.GetTorqueControlConfig();
+
+	FVehicleTargetRotationControlConfig TargetRotationControlCopy = TargetRotationControl;
+	Patch.TargetRotationControl = TargetRotationControlCopy.GetTargetRotationControlConfig();
+
+	FVehicleStabilizeControlConfig StabilizeControlCopy = StabilizeControl;
+	Patch.StabilizeControl = StabilizeControlCopy.GetStabilizeControlConfig();
+}
+
+void UChaosVehicleMovementComponent::BakeCurves()
+{
+	ThrottleInputRate.BakeCurves();
+	BrakeInputRate.BakeCurves();
+	SteeringInputRate.BakeCurves();
+	HandbrakeInputRate.BakeCurves();
+	PitchInputRate.BakeCurves();
+	RollInputRate.BakeCurves();
+	YawInputRate.BakeCurves();
+}
+
 void UChaosVehicleMovementComponent::SetupVehicleMass()
 {
 	if (UpdatedPrimitive && UpdatedPrimitive->GetBodyInstance())
@@ -1668,6 +2120,7 @@ void UChaosVehicleMovementComponent::SetCurrentAsyncInputOutputInternal(FChaosVe
 
 	CurAsyncInput = CurInput;
 	CurAsyncInput->Vehicle = this;
+	CurAsyncInput->Simulation = VehicleSimulationPT.Get();
 	CurAsyncType = CurInput->Type;
 	NextAsyncOutput = nullptr;
 	OutputInterpAlpha = 0.f;
@@ -1675,41 +2128,27 @@ void UChaosVehicleMovementComponent::SetCurrentAsyncInputOutputInternal(FChaosVe
 	// We need to find our vehicle in the output given
 	if (CurOutput)
 	{
-		for (int32 PendingOutputIdx = 0; PendingOutputIdx < OutputsWaitingOn.Num(); ++PendingOutputIdx)
+		// Found the correct pending output, use index to get the vehicle.
+		const int32 VehicleIdx = FindOutputWaitingOn(CurOutput->Timestamp);
+		if (VehicleIdx != INDEX_NONE)
 		{
-			// Found the correct pending output, use index to get the vehicle.
-			if (OutputsWaitingOn[PendingOutputIdx].Timestamp == CurOutput->Timestamp)
+			FChaosVehicleAsyncOutput* VehicleOutput = CurOutput->VehicleOutputs[VehicleIdx].Get();
+			if (VehicleOutput && VehicleOutput->bValid && VehicleOutput->Type == CurAsyncType)
 			{
-				const int32 VehicleIdx = OutputsWaitingOn[PendingOutputIdx].Idx;
-				FChaosVehicleAsyncOutput* VehicleOutput = CurOutput->VehicleOutputs[VehicleIdx].Get();
-				if (VehicleOutput && VehicleOutput->bValid && VehicleOutput->Type == CurAsyncType)
-				{
-					CurAsyncOutput = VehicleOutput;
+				CurAsyncOutput = VehicleOutput;
 
-					if (NextOutput && NextOutput->Timestamp == CurOutput->Timestamp)
+				if (NextOutput && NextOutput->Timestamp == CurOutput->Timestamp)
+				{
+					// This can occur when substepping - in this case, VehicleOutputs will be in the same order in NextOutput and CurOutput.
+					FChaosVehicleAsyncOutput* VehicleNextOutput = NextOutput->VehicleOutputs[VehicleIdx].Get();
+					if (VehicleNextOutput && VehicleNextOutput->bValid && VehicleNextOutput->Type == CurAsyncType)
 					{
-						// This can occur when substepping - in this case, VehicleOutputs will be in the same order in NextOutput and CurOutput.
-						FChaosVehicleAsyncOutput* VehicleNextOutput = NextOutput->VehicleOutputs[VehicleIdx].Get();
-						if (VehicleNextOutput && VehicleNextOutput->bValid && VehicleNextOutput->Type == CurAsyncType)
-						{
-							NextAsyncOutput = VehicleNextOutput;
-							OutputInterpAlpha = Alpha;
-						}
+						NextAsyncOutput = VehicleNextOutput;
+						OutputInterpAlpha = Alpha;
 					}
 				}
-
-				// these are sorted by timestamp, we are using latest, so remove entries that came before it.
-				TArray<FAsyncOutputWrapper> NewOutputsWaitingOn;
-				for (int32 CopyIndex = PendingOutputIdx; CopyIndex < OutputsWaitingOn.Num(); ++CopyIndex)
-				{
-					NewOutputsWaitingOn.Add(OutputsWaitingOn[CopyIndex]);
-				}
-
-				OutputsWaitingOn = MoveTemp(NewOutputsWaitingOn);
-				break;
 			}
 		}
-
 	}
 
 	if (NextOutput && CurOutput)
@@ -1717,24 +2156,27 @@ void UChaosVehicleMovementComponent::SetCurrentAsyncInputOutputInternal(FChaosVe
 		if (NextOutput->Timestamp != CurOutput->Timestamp)
 		{
 			// NextOutput and CurOutput occurred in different steps, so we need to search for our specific vehicle.
-			for (int32 PendingOutputIdx = 0; PendingOutputIdx < OutputsWaitingOn.Num(); ++PendingOutputIdx)
+			const int32 VehicleIdx = FindOutputWaitingOn(NextOutput->Timestamp);
+			if (VehicleIdx != INDEX_NONE)
 			{
-				// Found the correct pending output, use index to get the vehicle.
-				if (OutputsWaitingOn[PendingOutputIdx].Timestamp == NextOutput->Timestamp)
+				FChaosVehicleAsyncOutput* VehicleOutput = NextOutput->VehicleOutputs[VehicleIdx].Get();
+				if (VehicleOutput && VehicleOutput->bValid && VehicleOutput->Type == CurAsyncType)
 				{
-					FChaosVehicleAsyncOutput* VehicleOutput = NextOutput->VehicleOutputs[OutputsWaitingOn[PendingOutputIdx].Idx].Get();
-					if (VehicleOutput && VehicleOutput->bValid && VehicleOutput->Type == CurAsyncType)
-					{
-						NextAsyncOutput = VehicleOutput;
-						OutputInterpAlpha = Alpha;
-					}
-					break;
+					NextAsyncOutput = VehicleOutput;
+					OutputInterpAlpha = Alpha;
 				}
 			}
 		}
 	}
 
-	FAsyncOutputWrapper& NewOutput = OutputsWaitingOn.AddDefaulted_GetRef();
+	// no new output to view, so keep the last values before the old outputs are released
+	if (CurAsyncOutput == nullptr)
+	{
+		MaterializeOutputView();
+	}
+
+	// older entries are simply overwritten as the timestamp wraps around the ring
+	FAsyncOutputWrapper& NewOutput = OutputsWaitingOn[VehicleManagerTimestamp & (MaxOutputsWaitingOn - 1)];
 	NewOutput.Timestamp = VehicleManagerTimestamp;
 	NewOutput.Idx = InputIdx;
 }
@@ -1775,6 +2217,13 @@ void UChaosVehicleMovementComponent::Update(float DeltaTime)
 				}
 
 				AsyncInput->PhysicsInputs.GravityZ = GetGravityZ();
+				AsyncInput->PhysicsInputs.TuningPatch = MoveTemp(PendingTuningPatch);
+				AsyncInput->PhysicsInputs.bResetSimulation = bPendingSimulationReset;
+				bPendingSimulationReset = false;
+				if (PendingWheelClassChanges.Num() > 0)
+				{
+					AsyncInput->PhysicsInputs.WheelClassChanges = MoveTemp(PendingWheelClassChanges);
+				}
 			}
 		}
 	}
@@ -1785,8 +2234,17 @@ void UChaosVehicleMovementComponent::ResetVehicleState()
 	ClearRawInput();
 	StopMovementImmediately();
 
-	OnDestroyPhysicsState();
-	OnCreatePhysicsState();
+	if (VehicleSimulationPT && PVehicleOutput && GetBodyInstance())
+	{
+		// reset the dynamics of the existing vehicle, it keeps its systems, wheels, constraints and registration
+		// the physics thread may be stepping the vehicle, so the reset is applied ahead of the next step it simulates
+		bPendingSimulationReset = true;
+	}
+	else
+	{
+		OnDestroyPhysicsState();
+		OnCreatePhysicsState();
+	}
 
 	// Shift into neutral, force the local copy of target gear to be correct
 	SetTargetGear(0, true);
@@ -1814,6 +2272,12 @@ void UChaosVehicleMovementComponent::ParallelUpdate(float DeltaSeconds)
 			PVehicleOutput->CurrentGear = CurAsyncOutput->VehicleSimOutput.CurrentGear;
 			PVehicleOutput->TargetGear = CurAsyncOutput->VehicleSimOutput.TargetGear;
 
+			// wheels can be read through a view of the outputs, the manager keeps them alive until it consumes the next ones
+			const int32 NumOutputWheels = CurrentOutput->VehicleSimOutput.Wheels.Num();
+			const bool bUseOutputView = GVehicleDebugParams.EnableOutputViews && NumOutputWheels == PVehicleOutput->Wheels.Num()
+				&& (NextAsyncOutput == nullptr || NextAsyncOutput->VehicleSimOutput.Wheels.Num() == NumOutputWheels);
+			OutputView = bUseOutputView ? FVehicleOutputView(&CurrentOutput->VehicleSimOutput, NextAsyncOutput ? &NextAsyncOutput->VehicleSimOutput : nullptr, OutputInterpAlpha) : FVehicleOutputView();
+
 			// WHEN RUNNING WITH ASYNC ON & FIXED TIMESTEP THEN WE NEED TO INTERPOLATE BETWEEN THE CURRENT AND NEXT OUTPUT RESULTS
 			if (const FChaosVehicleAsyncOutput* NextOutput = static_cast<FChaosVehicleAsyncOutput*>(NextAsyncOutput))
 			{
@@ -1822,38 +2286,45 @@ void UChaosVehicleMovementComponent::ParallelUpdate(float DeltaSeconds)
 				PVehicleOutput->TransmissionRPM = FMath::Lerp(CurAsyncOutput->VehicleSimOutput.TransmissionRPM, NextAsyncOutput->VehicleSimOutput.TransmissionRPM, OutputInterpAlpha);
 				PVehicleOutput->TransmissionTorque = FMath::Lerp(CurAsyncOutput->VehicleSimOutput.TransmissionTorque, NextAsyncOutput->VehicleSimOutput.TransmissionTorque, OutputInterpAlpha);
 
-				for (int WheelIdx = 0; WheelIdx < CurrentOutput->VehicleSimOutput.Wheels.Num(); WheelIdx++)
+				if (bUseOutputView)
 				{
-					const FWheelsOutput& Current = CurrentOutput->VehicleSimOutput.Wheels[WheelIdx];
-					const FWheelsOutput& Next = NextOutput->VehicleSimOutput.Wheels[WheelIdx];
-
-					PVehicleOutput->Wheels[WheelIdx].InContact = Current.InContact;
-					PVehicleOutput->Wheels[WheelIdx].SteeringAngle = FMath::Lerp(Current.SteeringAngle, Next.SteeringAngle, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].WheelRadius = FMath::Lerp(Current.WheelRadius, Next.WheelRadius, OutputInterpAlpha);
-					float DeltaAngle = FMath::FindDeltaAngleRadians(Current.AngularPosition, Next.AngularPosition);
-					PVehicleOutput->Wheels[WheelIdx].AngularPosition = Current.AngularPosition + DeltaAngle * OutputInterpAlpha;
-					PVehicleOutput->Wheels[WheelIdx].AngularVelocity = FMath::Lerp(Current.AngularVelocity, Next.AngularVelocity, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].LateralAdhesiveLimit = FMath::Lerp(Current.LateralAdhesiveLimit, Next.LateralAdhesiveLimit, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].LongitudinalAdhesiveLimit = FMath::Lerp(Current.LongitudinalAdhesiveLimit, Next.LongitudinalAdhesiveLimit, OutputInterpAlpha);
-
-					PVehicleOutput->Wheels[WheelIdx].bIsSlipping = Current.bIsSlipping;
-					PVehicleOutput->Wheels[WheelIdx].SlipMagnitude = FMath::Lerp(Current.SlipMagnitude, Next.SlipMagnitude, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].bIsSkidding = Current.bIsSkidding;
-					PVehicleOutput->Wheels[WheelIdx].SkidMagnitude = FMath::Lerp(Current.SkidMagnitude, Next.SkidMagnitude, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].SkidNormal = FMath::Lerp(Current.SkidNormal, Next.SkidNormal, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].SlipAngle = FMath::Lerp(Current.SlipAngle, Next.SlipAngle, OutputInterpAlpha);
-
-					PVehicleOutput->Wheels[WheelIdx].SuspensionOffset = FMath::Lerp(Current.SuspensionOffset, Next.SuspensionOffset, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].SpringForce = FMath::Lerp(Current.SpringForce, Next.SpringForce, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].NormalizedSuspensionLength = FMath::Lerp(Current.NormalizedSuspensionLength, Next.NormalizedSuspensionLength, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].DriveTorque = FMath::Lerp(Current.DriveTorque, Next.DriveTorque, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].BrakeTorque = FMath::Lerp(Current.BrakeTorque, Next.BrakeTorque, OutputInterpAlpha);
-
-					PVehicleOutput->Wheels[WheelIdx].bABSActivated = Current.bABSActivated;
-					PVehicleOutput->Wheels[WheelIdx].bBlockingHit = Current.bBlockingHit;
-					PVehicleOutput->Wheels[WheelIdx].ImpactPoint = FMath::Lerp(Current.ImpactPoint, Next.ImpactPoint, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].HitLocation = FMath::Lerp(Current.HitLocation, Next.HitLocation, OutputInterpAlpha);
-					PVehicleOutput->Wheels[WheelIdx].PhysMaterial = Current.PhysMaterial;
+					// wheels are interpolated on demand through OutputView
+				}
+				else
+				{
+					for (int WheelIdx = 0; WheelIdx < CurrentOutput->VehicleSimOutput.Wheels.Num(); WheelIdx++)
+					{
+						const FWheelsOutput& Current = CurrentOutput->VehicleSimOutput.Wheels[WheelIdx];
+						const FWheelsOutput& Next = NextOutput->VehicleSimOutput.Wheels[WheelIdx];
+
+						PVehicleOutput->Wheels[WheelIdx].InContact = Current.InContact;
+						PVehicleOutput->Wheels[WheelIdx].SteeringAngle = FMath::Lerp(Current.SteeringAngle, Next.SteeringAngle, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].WheelRadius = FMath::Lerp(Current.WheelRadius, Next.WheelRadius, OutputInterpAlpha);
+						float DeltaAngle = FMath::FindDeltaAngleRadians(Current.AngularPosition, Next.AngularPosition);
+						PVehicleOutput->Wheels[WheelIdx].AngularPosition = Current.AngularPosition + DeltaAngle * OutputInterpAlpha;
+						PVehicleOutput->Wheels[WheelIdx].AngularVelocity = FMath::Lerp(Current.AngularVelocity, Next.AngularVelocity, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].LateralAdhesiveLimit = FMath::Lerp(Current.LateralAdhesiveLimit, Next.LateralAdhesiveLimit, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].LongitudinalAdhesiveLimit = FMath::Lerp(Current.LongitudinalAdhesiveLimit, Next.LongitudinalAdhesiveLimit, OutputInterpAlpha);
+
+						PVehicleOutput->Wheels[WheelIdx].bIsSlipping = Current.bIsSlipping;
+						PVehicleOutput->Wheels[WheelIdx].SlipMagnitude = FMath::Lerp(Current.SlipMagnitude, Next.SlipMagnitude, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].bIsSkidding = Current.bIsSkidding;
+						PVehicleOutput->Wheels[WheelIdx].SkidMagnitude = FMath::Lerp(Current.SkidMagnitude, Next.SkidMagnitude, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].SkidNormal = FMath::Lerp(Current.SkidNormal, Next.SkidNormal, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].SlipAngle = FMath::Lerp(Current.SlipAngle, Next.SlipAngle, OutputInterpAlpha);
+
+						PVehicleOutput->Wheels[WheelIdx].SuspensionOffset = FMath::Lerp(Current.SuspensionOffset, Next.SuspensionOffset, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].SpringForce = FMath::Lerp(Current.SpringForce, Next.SpringForce, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].NormalizedSuspensionLength = FMath::Lerp(Current.NormalizedSuspensionLength, Next.NormalizedSuspensionLength, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].DriveTorque = FMath::Lerp(Current.DriveTorque, Next.DriveTorque, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].BrakeTorque = FMath::Lerp(Current.BrakeTorque, Next.BrakeTorque, OutputInterpAlpha);
+
+						PVehicleOutput->Wheels[WheelIdx].bABSActivated = Current.bABSActivated;
+						PVehicleOutput->Wheels[WheelIdx].bBlockingHit = Current.bBlockingHit;
+						PVehicleOutput->Wheels[WheelIdx].ImpactPoint = FMath::Lerp(Current.ImpactPoint, Next.ImpactPoint, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].HitLocation = FMath::Lerp(Current.HitLocation, Next.HitLocation, OutputInterpAlpha);
+						PVehicleOutput->Wheels[WheelIdx].PhysMaterial = Current.PhysMaterial;
+					}
 				}
 			}
 			else // WHEN ASYNC IS OFF IT STILL GENERATES THE ASYNC CALLBACK BUT THERE IS ONLY EVER THE CURRENT AND NO NEXT OUTPUT TO INTERPOLATE BETWEEN
@@ -1863,36 +2334,39 @@ void UChaosVehicleMovementComponent::ParallelUpdate(float DeltaSeconds)
 				PVehicleOutput->TransmissionRPM = CurAsyncOutput->VehicleSimOutput.TransmissionRPM;
 				PVehicleOutput->TransmissionTorque = CurAsyncOutput->VehicleSimOutput.TransmissionTorque;
 
-				for (int WheelIdx = 0; WheelIdx < CurrentOutput->VehicleSimOutput.Wheels.Num(); WheelIdx++)
+				if (!bUseOutputView)
 				{
-					const FWheelsOutput& Current = CurrentOutput->VehicleSimOutput.Wheels[WheelIdx];
-
-					PVehicleOutput->Wheels[WheelIdx].InContact = Current.InContact;
-					PVehicleOutput->Wheels[WheelIdx].SteeringAngle = Current.SteeringAngle;
-					PVehicleOutput->Wheels[WheelIdx].WheelRadius = Current.WheelRadius;
-					PVehicleOutput->Wheels[WheelIdx].AngularPosition = Current.AngularPosition;
-					PVehicleOutput->Wheels[WheelIdx].AngularVelocity = Current.AngularVelocity;
-					PVehicleOutput->Wheels[WheelIdx].LateralAdhesiveLimit = Current.LateralAdhesiveLimit;
-					PVehicleOutput->Wheels[WheelIdx].LongitudinalAdhesiveLimit = Current.LongitudinalAdhesiveLimit;
-
-					PVehicleOutput->Wheels[WheelIdx].bIsSlipping = Current.bIsSlipping;
-					PVehicleOutput->Wheels[WheelIdx].SlipMagnitude = Current.SlipMagnitude;
-					PVehicleOutput->Wheels[WheelIdx].bIsSkidding = Current.bIsSkidding;
-					PVehicleOutput->Wheels[WheelIdx].SkidMagnitude = Current.SkidMagnitude;
-					PVehicleOutput->Wheels[WheelIdx].SkidNormal = Current.SkidNormal;
-					PVehicleOutput->Wheels[WheelIdx].SlipAngle = Current.SlipAngle;
-
-					PVehicleOutput->Wheels[WheelIdx].SuspensionOffset = Current.SuspensionOffset;
-					PVehicleOutput->Wheels[WheelIdx].SpringForce = Current.SpringForce;
-					PVehicleOutput->Wheels[WheelIdx].NormalizedSuspensionLength = Current.NormalizedSuspensionLength;
-					PVehicleOutput->Wheels[WheelIdx].DriveTorque = Current.DriveTorque;
-					PVehicleOutput->Wheels[WheelIdx].BrakeTorque = Current.BrakeTorque;
-
-					PVehicleOutput->Wheels[WheelIdx].bABSActivated = Current.bABSActivated;
-					PVehicleOutput->Wheels[WheelIdx].bBlockingHit = Current.bBlockingHit;
-					PVehicleOutput->Wheels[WheelIdx].ImpactPoint = Current.ImpactPoint;
-					PVehicleOutput->Wheels[WheelIdx].HitLocation = Current.HitLocation;
-					PVehicleOutput->Wheels[WheelIdx].PhysMaterial = Current.PhysMaterial;
+					for (int WheelIdx = 0; WheelIdx < CurrentOutput->VehicleSimOutput.Wheels.Num(); WheelIdx++)
+					{
+						const FWheelsOutput& Current = CurrentOutput->VehicleSimOutput.Wheels[WheelIdx];
+
+						PVehicleOutput->Wheels[WheelIdx].InContact = Current.InContact;
+						PVehicleOutput->Wheels[WheelIdx].SteeringAngle = Current.SteeringAngle;
+						PVehicleOutput->Wheels[WheelIdx].WheelRadius = Current.WheelRadius;
+						PVehicleOutput->Wheels[WheelIdx].AngularPosition = Current.AngularPosition;
+						PVehicleOutput->Wheels[WheelIdx].AngularVelocity = Current.AngularVelocity;
+						PVehicleOutput->Wheels[WheelIdx].LateralAdhesiveLimit = Current.LateralAdhesiveLimit;
+						PVehicleOutput->Wheels[WheelIdx].LongitudinalAdhesiveLimit = Current.LongitudinalAdhesiveLimit;
+
+						PVehicleOutput->Wheels[WheelIdx].bIsSlipping = Current.bIsSlipping;
+						PVehicleOutput->Wheels[WheelIdx].SlipMagnitude = Current.SlipMagnitude;
+						PVehicleOutput->Wheels[WheelIdx].bIsSkidding = Current.bIsSkidding;
+						PVehicleOutput->Wheels[WheelIdx].SkidMagnitude = Current.SkidMagnitude;
+						PVehicleOutput->Wheels[WheelIdx].SkidNormal = Current.SkidNormal;
+						PVehicleOutput->Wheels[WheelIdx].SlipAngle = Current.SlipAngle;
+
+						PVehicleOutput->Wheels[WheelIdx].SuspensionOffset = Current.SuspensionOffset;
+						PVehicleOutput->Wheels[WheelIdx].SpringForce = Current.SpringForce;
+						PVehicleOutput->Wheels[WheelIdx].NormalizedSuspensionLength = Current.NormalizedSuspensionLength;
+						PVehicleOutput->Wheels[WheelIdx].DriveTorque = Current.DriveTorque;
+						PVehicleOutput->Wheels[WheelIdx].BrakeTorque = Current.BrakeTorque;
+
+						PVehicleOutput->Wheels[WheelIdx].bABSActivated = Current.bABSActivated;
+						PVehicleOutput->Wheels[WheelIdx].bBlockingHit = Current.bBlockingHit;
+						PVehicleOutput->Wheels[WheelIdx].ImpactPoint = Current.ImpactPoint;
+						PVehicleOutput->Wheels[WheelIdx].HitLocation = Current.HitLocation;
+						PVehicleOutput->Wheels[WheelIdx].PhysMaterial = Current.PhysMaterial;
+					}
 				}
 
 			}
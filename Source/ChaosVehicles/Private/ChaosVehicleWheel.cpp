@@ -14,6 +14,13 @@
 PRAGMA_DISABLE_OPTIMIZATION
 #endif
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumSharedWheelConfigsBuilt"), STAT_NumSharedWheelConfigsBuilt, STATGROUP_ChaosVehicleManager);
+
+namespace ChaosVehicleWheel
+{
+	/** Setups shared by all the wheels of a class, keyed weakly so unloaded classes can be pruned */
+	TMap<TWeakObjectPtr<UClass>, TSharedPtr<const FChaosVehicleWheelSharedConfig>> SharedConfigs;
+}
 
 UChaosVehicleWheel::UChaosVehicleWheel(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -53,6 +60,42 @@ UChaosVehicleWheel::UChaosVehicleWheel(const FObjectInitializer& ObjectInitializ
 }
 
 
+TSharedPtr<const FChaosVehicleWheelSharedConfig> UChaosVehicleWheel::GetSharedConfig(TSubclassOf<UChaosVehicleWheel> WheelClass)
+{
+	using namespace ChaosVehicleWheel;
+
+	UChaosVehicleWheel* Wheel = WheelClass.GetDefaultObject();
+	if (Wheel == nullptr)
+	{
+		return nullptr;
+	}
+
+	const TSharedPtr<const FChaosVehicleWheelSharedConfig>* Found = SharedConfigs.Find(WheelClass.Get());
+	if (Found && (*Found)->VehicleSetupTag == FChaosVehicleManager::VehicleSetupTag)
+	{
+		return *Found;
+	}
+
+	// the class default object is only filled in here, vehicles copy the shared setup so it's never read while being rebuilt
+	TSharedPtr<FChaosVehicleWheelSharedConfig> SharedConfig = MakeShared<FChaosVehicleWheelSharedConfig>();
+	SharedConfig->WheelConfig = Wheel->GetPhysicsWheelConfig();
+	SharedConfig->SuspensionConfig = Wheel->GetPhysicsSuspensionConfig();
+	SharedConfig->VehicleSetupTag = FChaosVehicleManager::VehicleSetupTag;
+
+	for (auto It = SharedConfigs.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	SharedConfigs.Add(WheelClass.Get(), SharedConfig);
+	INC_DWORD_STAT(STAT_NumSharedWheelConfigsBuilt);
+
+	return SharedConfig;
+}
+
 FChaosVehicleManager* UChaosVehicleWheel::GetVehicleManager() const
 {
 	UWorld* World = GEngine->GetWorldFromContextObject(VehicleComponent, EGetWorldErrorMode::LogAndReturnNull);
@@ -63,13 +106,13 @@ FChaosVehicleManager* UChaosVehicleWheel::GetVehicleManager() const
 float UChaosVehicleWheel::GetSteerAngle() const
 {
 	check(VehicleComponent && VehicleComponent->PhysicsVehicleOutput());
-	return VehicleComponent->PhysicsVehicleOutput()->Wheels[WheelIndex].SteeringAngle;
+	return VehicleComponent->GetOutputView().GetSteeringAngle(WheelIndex);
 }
 
 float UChaosVehicleWheel::GetRotationAngle() const
 {
 	check(VehicleComponent && VehicleComponent->PhysicsVehicleOutput());
-	float RotationAngle = -1.0f * FMath::RadiansToDegrees(VehicleComponent->PhysicsVehicleOutput()->Wheels[WheelIndex].AngularPosition);
+	float RotationAngle = -1.0f * FMath::RadiansToDegrees(VehicleComponent->GetOutputView().GetAngularPosition(WheelIndex));
 	ensure(!FMath::IsNaN(RotationAngle));
 	return RotationAngle;
 }
@@ -77,7 +120,7 @@ float UChaosVehicleWheel::GetRotationAngle() const
 float UChaosVehicleWheel::GetRotationAngularVelocity() const
 {
 	check(VehicleComponent && VehicleComponent->PhysicsVehicleOutput());
-	float RotationAngularVelocity = -1.0f * FMath::RadiansToDegrees(VehicleComponent->PhysicsVehicleOutput()->Wheels[WheelIndex].AngularVelocity);
+	float RotationAngularVelocity = -1.0f * FMath::RadiansToDegrees(VehicleComponent->GetOutputView().GetAngularVelocity(WheelIndex));
 	ensure(!FMath::IsNaN(RotationAngularVelocity));
 	return RotationAngularVelocity;
 }
@@ -86,13 +129,13 @@ float UChaosVehicleWheel::GetRotationAngularVelocity() const
 float UChaosVehicleWheel::GetWheelRadius() const
 {
 	check(VehicleComponent && VehicleComponent->PhysicsVehicleOutput());
-	return VehicleComponent->PhysicsVehicleOutput()->Wheels[WheelIndex].WheelRadius;
+	return VehicleComponent->GetOutputView().GetWheelRadius(WheelIndex);
 }
 
 float UChaosVehicleWheel::GetWheelAngularVelocity() const
 {
 	check(VehicleComponent && VehicleComponent->PhysicsVehicleOutput());
-	return VehicleComponent->PhysicsVehicleOutput()->Wheels[WheelIndex].AngularVelocity;
+	return VehicleComponent->GetOutputView().GetAngularVelocity(WheelIndex);
 }
 
 float UChaosVehicleWheel::GetSuspensionOffset() const
@@ -110,7 +153,7 @@ FVector UChaosVehicleWheel::GetSuspensionAxis() const
 bool UChaosVehicleWheel::IsInAir() const
 {
 	check(VehicleComponent && VehicleComponent->PhysicsVehicleOutput());
-	return !VehicleComponent->PhysicsVehicleOutput()->Wheels[WheelIndex].InContact;
+	return !VehicleComponent->GetOutputView().GetInContact(WheelIndex);
 }
 
 
@@ -152,8 +195,19 @@ FVector UChaosVehicleWheel::GetPhysicsLocation()
 
 void UChaosVehicleWheel::PostEditChangeProperty( FPropertyChangedEvent& PropertyChangedEvent )
 {
-	// Trigger a runtime rebuild of the Physics vehicle
-	FChaosVehicleManager::VehicleSetupTag++;
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+
+	if (PropertyName == NAME_None)
+	{
+		// Trigger a runtime rebuild of the Physics vehicle
+		FChaosVehicleManager::VehicleSetupTag++;
+	}
+	else if (HasAnyFlags(RF_ClassDefaultObject))
+	{
+		// Only the class default object feeds the shared setup, rebuild this class's entry and patch it into the running vehicles using it
+		ChaosVehicleWheel::SharedConfigs.Remove(GetClass());
+		FChaosVehicleManager::NotifyTuningChanged(GetClass());
+	}
 
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
@@ -16,6 +16,7 @@
 #include "ChaosVehicleManager.h"
 #include "ChaosVehicleWheel.h"
 #include "SuspensionUtility.h"
+#include "HeightfieldContactProvider.h"
 #include "SteeringUtility.h"
 #include "TransmissionUtility.h"
 #include "Chaos/ChaosEngineInterface.h"
@@ -41,6 +42,8 @@ DECLARE_STATS_GROUP(TEXT("ChaosVehicle"), STATGROUP_ChaosVehicle, STATGROUP_Adva
 DECLARE_CYCLE_STAT(TEXT("Vehicle:SuspensionRaycasts"), STAT_ChaosVehicle_SuspensionRaycasts, STATGROUP_ChaosVehicle);
 DECLARE_CYCLE_STAT(TEXT("Vehicle:SuspensionOverlapTest"), STAT_ChaosVehicle_SuspensionOverlapTest, STATGROUP_ChaosVehicle);
 DECLARE_CYCLE_STAT(TEXT("Vehicle:SuspensionTraces"), STAT_ChaosVehicle_SuspensionTraces, STATGROUP_ChaosVehicle);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Vehicle:OverlapCacheHits"), STAT_ChaosVehicle_OverlapCacheHits, STATGROUP_ChaosVehicle);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Vehicle:OverlapCacheMisses"), STAT_ChaosVehicle_OverlapCacheMisses, STATGROUP_ChaosVehicle);
 DECLARE_CYCLE_STAT(TEXT("Vehicle:TickVehicle"), STAT_ChaosVehicle_TickVehicle, STATGROUP_ChaosVehicle);
 DECLARE_CYCLE_STAT(TEXT("Vehicle:UpdateSimulation"), STAT_ChaosVehicle_UpdateSimulation, STATGROUP_ChaosVehicle);
 
@@ -72,6 +75,15 @@ FAutoConsoleVariableRef CVarChaosVehiclesResetMeasurements(TEXT("p.Vehicle.Reset
 
 FAutoConsoleVariableRef CVarChaosVehiclesOverlapTestExpansionXY(TEXT("p.Vehicle.OverlapTestExpansionXY"), GWheeledVehicleDebugParams.OverlapTestExpansionXY, TEXT("Raycast Overlap Test Expansion of Bounding Box in X/Y axes."));
 FAutoConsoleVariableRef CVarChaosVehiclesOverlapTestExpansionXZ(TEXT("p.Vehicle.OverlapTestExpansionZ"), GWheeledVehicleDebugParams.OverlapTestExpansionZ, TEXT("Raycast Overlap Test Expansion of Bounding Box in Z axis"));
+FAutoConsoleVariableRef CVarChaosVehiclesOverlapCachePredictionTime(TEXT("p.Vehicle.OverlapCachePredictionTime"), GWheeledVehicleDebugParams.OverlapCachePredictionTime, TEXT("Time in seconds the cached overlap test box is extended ahead of the vehicle's velocity (only valid when CacheTraceOverlap enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesOverlapCacheMaxPrediction(TEXT("p.Vehicle.OverlapCacheMaxPrediction"), GWheeledVehicleDebugParams.OverlapCacheMaxPrediction, TEXT("Maximum distance the cached overlap test box is extended ahead of the vehicle (only valid when CacheTraceOverlap enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesEnableTraceReuse(TEXT("p.Vehicle.EnableTraceReuse"), GWheeledVehicleDebugParams.EnableTraceReuse, TEXT("Enable/Disable reusing the previous suspension hit while a wheel has barely moved over a static surface."));
+FAutoConsoleVariableRef CVarChaosVehiclesTraceReuseTolerance(TEXT("p.Vehicle.TraceReuseTolerance"), GWheeledVehicleDebugParams.TraceReuseTolerance, TEXT("Distance a suspension trace can move before it must be traced again (only valid when EnableTraceReuse enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesTraceReuseMaxSteps(TEXT("p.Vehicle.TraceReuseMaxSteps"), GWheeledVehicleDebugParams.TraceReuseMaxSteps, TEXT("Number of steps in a row a suspension trace can be reused before it must be traced again (only valid when EnableTraceReuse enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesEnableHeightfieldContacts(TEXT("p.Vehicle.EnableHeightfieldContacts"), GWheeledVehicleDebugParams.EnableHeightfieldContacts, TEXT("Enable/Disable sampling landscape heightfields directly instead of tracing against them (only valid when BatchQueries enabled)."));
+FAutoConsoleVariableRef CVarChaosVehiclesEnableAsyncSuspensionOffsetTraces(TEXT("p.Vehicle.EnableAsyncSuspensionOffsetTraces"), GWheeledVehicleDebugParams.EnableAsyncSuspensionOffsetTraces, TEXT("Enable/Disable batching the game thread suspension offset traces through the vehicle manager as async traces instead of tracing immediately."));
+FAutoConsoleVariableRef CVarChaosVehiclesEnableLocalSpaceWheelState(TEXT("p.Vehicle.EnableLocalSpaceWheelState"), GWheeledVehicleDebugParams.EnableLocalSpaceWheelState, TEXT("Enable/Disable capturing the wheel state relative to the chassis in single precision, rather than in double precision world space."));
+FAutoConsoleVariableRef CVarChaosVehiclesEnableVectorWheelFrames(TEXT("p.Vehicle.EnableVectorWheelFrames"), GWheeledVehicleDebugParams.EnableVectorWheelFrames, TEXT("Enable/Disable working out the steering and ground contact frames of four wheels at a time when applying wheel friction forces."));
 
 //FAutoConsoleVariableRef CVarChaosVehiclesDisableSuspensionConstraints(TEXT("p.Vehicle.DisableSuspensionConstraint"), GWheeledVehicleDebugParams.DisableSuspensionConstraint, TEXT("Enable/Disable Suspension Constraints."));
 
@@ -142,6 +154,18 @@ void FWheelState::CaptureState(int WheelIdx, const FVector& WheelOffset, const C
 	LocalWheelVelocity[WheelIdx] = WorldTransform.InverseTransformVector(WorldWheelVelocity[WheelIdx]);
 }
 
+void FWheelState::CaptureState(int WheelIdx, const FVector& WheelOffset, const FVehicleState& VehicleState)
+{
+	// velocity at the wheel from the chassis velocities rotated into its frame, only the world location needs the double precision origin
+	const FVector3f LocalOffset(WheelOffset);
+	const FVector3f LocalVelocity = FVector3f(VehicleState.VehicleLocalVelocity) - FVector3f::CrossProduct(LocalOffset - VehicleState.LocalCOM, VehicleState.LocalAngularVelocity);
+
+	WheelLocalLocation[WheelIdx] = WheelOffset;
+	WheelWorldLocation[WheelIdx] = VehicleState.VehicleWorldTransform.GetLocation() + FVector(VehicleState.LocalFrameRotation.RotateVector(LocalOffset));
+	LocalWheelVelocity[WheelIdx] = FVector(LocalVelocity);
+	WorldWheelVelocity[WheelIdx] = FVector(VehicleState.LocalFrameRotation.RotateVector(LocalVelocity));
+}
+
 FVector FWheelState::GetVelocityAtPoint(const Chaos::FRigidBodyHandle_Internal* Rigid, const FVector& InPoint)
 {
 	if (Rigid)
@@ -179,61 +203,108 @@ void UChaosWheeledVehicleSimulation::TickVehicle(UWorld* WorldIn, float DeltaTim
 }
 
 
-void UChaosWheeledVehicleSimulation::UpdateState(float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle)
+/** Whether a wheel's suspension trace should use complex collision, honouring p.Vehicle.TraceTypeOverride */
+static bool IsWheelTraceComplex(const FWheelTraceParams& WheelTraceParams)
 {
-	UChaosVehicleSimulation::UpdateState(DeltaTime, InputData, Handle);
+	if (GWheeledVehicleDebugParams.TraceTypeOverride > 0)
+	{
+		return GWheeledVehicleDebugParams.TraceTypeOverride == 2;
+	}
 
-	if (CanSimulate() && Handle)
+	return (WheelTraceParams.SweepType == ESweepType::ComplexSweep);
+}
+
+void UChaosWheeledVehicleSimulation::CaptureWheelState(Chaos::FRigidBodyHandle_Internal* Handle)
+{
+	// sanity check that everything is setup ok
+	ensure(PVehicle->Wheels.Num() == PVehicle->Suspension.Num());
+	ensure(WheelState.LocalWheelVelocity.Num() == PVehicle->Wheels.Num());
+	ensure(WheelState.WheelWorldLocation.Num() == PVehicle->Wheels.Num());
+	ensure(WheelState.WorldWheelVelocity.Num() == PVehicle->Wheels.Num());
+
+	///////////////////////////////////////////////////////////////////////
+	// Cache useful state so we are not re-calculating the same data
+	for (int WheelIdx = 0; WheelIdx < PVehicle->Suspension.Num(); WheelIdx++)
 	{
-		// sanity check that everything is setup ok
-		ensure(PVehicle->Wheels.Num() == PVehicle->Suspension.Num());
-		ensure(WheelState.LocalWheelVelocity.Num() == PVehicle->Wheels.Num());
-		ensure(WheelState.WheelWorldLocation.Num() == PVehicle->Wheels.Num());
-		ensure(WheelState.WorldWheelVelocity.Num() == PVehicle->Wheels.Num());
+		bool bCaptured = false;
 
-		///////////////////////////////////////////////////////////////////////
-		// Cache useful state so we are not re-calculating the same data
-		for (int WheelIdx = 0; WheelIdx < PVehicle->Suspension.Num(); WheelIdx++)
+		// #TODO: This is not threadsafe - need to rethink how to get the rigidbody that is hit by the raycast
+		//const FHitResult& HitResult = Wheels[WheelIdx]->HitResult;
+		//if (HitResult.Component.IsValid() && HitResult.Component->GetBodyInstance())
+		//{
+		//	if (const FPhysicsActorHandle& SurfaceHandle = HitResult.Component->GetBodyInstance()->GetPhysicsActorHandle())
+		//	{
+		//		// we are being called from the physics thread
+		//		if (Chaos::FRigidBodyHandle_Internal* SurfaceBody = SurfaceHandle->GetPhysicsThreadAPI())
+		//		{
+		//			if (SurfaceBody->CanTreatAsKinematic())
+		//			{
+		//				FVector Point = HitResult.ImpactPoint;
+		//				WheelState.CaptureState(WheelIdx, PVehicle->Suspension[WheelIdx].GetLocalRestingPosition(), Handle, Point, SurfaceBody);
+		//				bCaptured = true;
+		//			}
+		//		}
+		//	}
+		//}
+
+		if (!bCaptured)
 		{
-			bool bCaptured = false;
-
-			// #TODO: This is not threadsafe - need to rethink how to get the rigidbody that is hit by the raycast
-			//const FHitResult& HitResult = Wheels[WheelIdx]->HitResult;
-			//if (HitResult.Component.IsValid() && HitResult.Component->GetBodyInstance())
-			//{
-			//	if (const FPhysicsActorHandle& SurfaceHandle = HitResult.Component->GetBodyInstance()->GetPhysicsActorHandle())
-			//	{
-			//		// we are being called from the physics thread
-			//		if (Chaos::FRigidBodyHandle_Internal* SurfaceBody = SurfaceHandle->GetPhysicsThreadAPI())
-			//		{
-			//			if (SurfaceBody->CanTreatAsKinematic())
-			//			{
-			//				FVector Point = HitResult.ImpactPoint;
-			//				WheelState.CaptureState(WheelIdx, PVehicle->Suspension[WheelIdx].GetLocalRestingPosition(), Handle, Point, SurfaceBody);
-			//				bCaptured = true;
-			//			}
-			//		}
-			//	}
-			//}
-
-			if (!bCaptured)
+			if (GWheeledVehicleDebugParams.EnableLocalSpaceWheelState)
+			{
+				WheelState.CaptureState(WheelIdx, PVehicle->Suspension[WheelIdx].GetLocalRestingPosition(), VehicleState);
+			}
+			else
 			{
 				WheelState.CaptureState(WheelIdx, PVehicle->Suspension[WheelIdx].GetLocalRestingPosition(), Handle);
 			}
 		}
-		///////////////////////////////////////////////////////////////////////
-		// Suspension Raycast
+	}
+	///////////////////////////////////////////////////////////////////////
+	// Suspension Raycast
 
-		for (int WheelIdx = 0; WheelIdx < PVehicle->Suspension.Num(); WheelIdx++)
+	for (int WheelIdx = 0; WheelIdx < PVehicle->Suspension.Num(); WheelIdx++)
+	{
+		auto& PSuspension = PVehicle->Suspension[WheelIdx];
+		auto& PWheel = PVehicle->Wheels[WheelIdx];
+		PSuspension.UpdateWorldRaycastLocation(VehicleState.VehicleWorldTransform, PWheel.GetEffectiveRadius(), WheelState.Trace[WheelIdx]);
+	}
+}
+
+void UChaosWheeledVehicleSimulation::UpdateState(float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle)
+{
+	// when batched the state has already been captured this step, capturing again would corrupt the frame to frame acceleration
+	const bool bTracesBatched = bSuspensionTracesBatched;
+	bSuspensionTracesBatched = false;
+
+	if (!bTracesBatched)
+	{
+		UChaosVehicleSimulation::UpdateState(DeltaTime, InputData, Handle);
+	}
+
+	if (CanSimulate() && Handle)
+	{
+		if (!bTracesBatched)
 		{
-			auto& PSuspension = PVehicle->Suspension[WheelIdx];
-			auto& PWheel = PVehicle->Wheels[WheelIdx];
-			PSuspension.UpdateWorldRaycastLocation(VehicleState.VehicleWorldTransform, PWheel.GetEffectiveRadius(), WheelState.Trace[WheelIdx]);
+			CaptureWheelState(Handle);
+
+			if (!GWheeledVehicleDebugParams.DisableSuspensionForces && PVehicle->bSuspensionEnabled && InputData.PhysicsInputs.TraceQueryParams)
+			{
+				PerformSuspensionTraces(WheelState.Trace, *InputData.PhysicsInputs.TraceQueryParams);
+			}
 		}
 
-		if (!GWheeledVehicleDebugParams.DisableSuspensionForces && PVehicle->bSuspensionEnabled)
+		if (GWheeledVehicleDebugParams.EnableTraceReuse)
 		{
-			PerformSuspensionTraces(WheelState.Trace, InputData.PhysicsInputs.TraceParams, InputData.PhysicsInputs.TraceCollisionResponse, InputData.PhysicsInputs.WheelTraceParams);
+			// look at what the new traces hit once, rather than every step they are reused
+			for (int WheelIdx = 0; WheelIdx < WheelState.TraceResult.Num(); WheelIdx++)
+			{
+				if (!WheelState.TraceReused[WheelIdx])
+				{
+					const FHitResult& HitResult = WheelState.TraceResult[WheelIdx];
+					const UPrimitiveComponent* Component = HitResult.bBlockingHit ? HitResult.Component.Get() : nullptr;
+					WheelState.CachedTraceReusable[WheelIdx] = Component && Component->Mobility == EComponentMobility::Static;
+				}
+			}
 		}
 
 		//////////////////////////////////////////////////////////////////////////
@@ -257,6 +328,50 @@ void UChaosWheeledVehicleSimulation::UpdateState(float DeltaTime, const FChaosVe
 	}
 }
 
+bool UChaosWheeledVehicleSimulation::PrepareBatchedQueries(UWorld* WorldIn, float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle)
+{
+	bSuspensionTracesBatched = false;
+
+	if (VehicleState.bSleeping || !CanSimulate() || Handle == nullptr || GWheeledVehicleDebugParams.DisableSuspensionForces || !PVehicle->bSuspensionEnabled || !InputData.PhysicsInputs.TraceQueryParams)
+	{
+		return false;
+	}
+
+	World = WorldIn;
+	RigidHandle = Handle;
+
+	UChaosVehicleSimulation::UpdateState(DeltaTime, InputData, Handle);
+	CaptureWheelState(Handle);
+
+	bSuspensionTracesBatched = true;
+	return true;
+}
+
+void UChaosWheeledVehicleSimulation::AddBatchedQueries(const FChaosVehicleAsyncInput& InputData, FSuspensionQueryBatch& QueryBatch)
+{
+	const FVehicleTraceQueryParams& QueryParams = *InputData.PhysicsInputs.TraceQueryParams;
+	const TArray<FWheelTraceParams>& WheelTraceParams = QueryParams.WheelTraceParams;
+
+	if (ReuseSuspensionTraces(WheelState.Trace, WheelTraceParams) == WheelState.Trace.Num())
+	{
+		return;
+	}
+
+	for (int WheelIdx = 0; WheelIdx < WheelState.Trace.Num(); WheelIdx++)
+	{
+		if (WheelState.TraceReused[WheelIdx])
+		{
+			continue;
+		}
+
+		const bool bTraceComplex = IsWheelTraceComplex(WheelTraceParams[WheelIdx]);
+		const float SweepRadius = (WheelTraceParams[WheelIdx].SweepShape == ESweepShape::Spherecast) ? PVehicle->Wheels[WheelIdx].GetEffectiveRadius() : 0.0f;
+
+		QueryBatch.AddQuery(WheelState.Trace[WheelIdx].Start, WheelState.Trace[WheelIdx].End, SweepRadius, bTraceComplex
+			, QueryParams.GetTraceParams(bTraceComplex), QueryParams.TraceCollisionResponse, WheelState.TraceResult[WheelIdx]);
+	}
+}
+
 void UChaosWheeledVehicleSimulation::UpdateSimulation(float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ChaosVehicle_UpdateSimulation);
@@ -276,9 +391,9 @@ void UChaosWheeledVehicleSimulation::UpdateSimulation(float DeltaTime, const FCh
 		///////////////////////////////////////////////////////////////////////
 		// Suspension
 
-		if (!GWheeledVehicleDebugParams.DisableSuspensionForces && PVehicle->bSuspensionEnabled)
+		if (!GWheeledVehicleDebugParams.DisableSuspensionForces && PVehicle->bSuspensionEnabled && InputData.PhysicsInputs.TraceQueryParams)
 		{
-			ApplySuspensionForces(DeltaTime, InputData.PhysicsInputs.WheelTraceParams);
+			ApplySuspensionForces(DeltaTime, InputData.PhysicsInputs.TraceQueryParams->WheelTraceParams);
 		}
 
 		///////////////////////////////////////////////////////////////////////
@@ -303,6 +418,37 @@ void UChaosWheeledVehicleSimulation::UpdateSimulation(float DeltaTime, const FCh
 	}
 }
 
+namespace ChaosVehicleNarrowPhase
+{
+	/** Bounds of four wheel traces laid out so one component can be tested against all four at once */
+	struct FTraceBounds4
+	{
+		FTraceBounds4() {}
+
+		explicit FTraceBounds4(const FBox (&Bounds)[4])
+		{
+			MinX = MakeVectorRegisterFloat((float)Bounds[0].Min.X, (float)Bounds[1].Min.X, (float)Bounds[2].Min.X, (float)Bounds[3].Min.X);
+			MinY = MakeVectorRegisterFloat((float)Bounds[0].Min.Y, (float)Bounds[1].Min.Y, (float)Bounds[2].Min.Y, (float)Bounds[3].Min.Y);
+			MinZ = MakeVectorRegisterFloat((float)Bounds[0].Min.Z, (float)Bounds[1].Min.Z, (float)Bounds[2].Min.Z, (float)Bounds[3].Min.Z);
+			MaxX = MakeVectorRegisterFloat((float)Bounds[0].Max.X, (float)Bounds[1].Max.X, (float)Bounds[2].Max.X, (float)Bounds[3].Max.X);
+			MaxY = MakeVectorRegisterFloat((float)Bounds[0].Max.Y, (float)Bounds[1].Max.Y, (float)Bounds[2].Max.Y, (float)Bounds[3].Max.Y);
+			MaxZ = MakeVectorRegisterFloat((float)Bounds[0].Max.Z, (float)Bounds[1].Max.Z, (float)Bounds[2].Max.Z, (float)Bounds[3].Max.Z);
+		}
+
+		/** One bit per lane whose bounds overlap Box */
+		uint32 OverlapMask(const FBox& Box) const
+		{
+			VectorRegister4Float Overlap = VectorBitwiseAnd(VectorCompareLE(MinX, VectorSetFloat1((float)Box.Max.X)), VectorCompareGE(MaxX, VectorSetFloat1((float)Box.Min.X)));
+			Overlap = VectorBitwiseAnd(Overlap, VectorBitwiseAnd(VectorCompareLE(MinY, VectorSetFloat1((float)Box.Max.Y)), VectorCompareGE(MaxY, VectorSetFloat1((float)Box.Min.Y))));
+			Overlap = VectorBitwiseAnd(Overlap, VectorBitwiseAnd(VectorCompareLE(MinZ, VectorSetFloat1((float)Box.Max.Z)), VectorCompareGE(MaxZ, VectorSetFloat1((float)Box.Min.Z))));
+			return (uint32)VectorMaskBits(Overlap);
+		}
+
+		VectorRegister4Float MinX, MinY, MinZ;
+		VectorRegister4Float MaxX, MaxY, MaxZ;
+	};
+}
+
 bool UChaosWheeledVehicleSimulation::ContainsTraces(const FBox& Box, const TArray<Chaos::FSuspensionTrace>& SuspensionTrace)
 {
 	const Chaos::FAABB3 Aabb(Box.Min, Box.Max);
@@ -318,23 +464,128 @@ bool UChaosWheeledVehicleSimulation::ContainsTraces(const FBox& Box, const TArra
 	return true;
 }
 
-void UChaosWheeledVehicleSimulation::PerformSuspensionTraces(const TArray<Chaos::FSuspensionTrace>& SuspensionTrace, FCollisionQueryParams& TraceParams, FCollisionResponseContainer& CollisionResponse, TArray<FWheelTraceParams>& WheelTraceParams)
+int32 UChaosWheeledVehicleSimulation::ReuseSuspensionTraces(const TArray<Chaos::FSuspensionTrace>& SuspensionTrace, const TArray<FWheelTraceParams>& WheelTraceParams)
+{
+	const float ToleranceSq = FMath::Square(GWheeledVehicleDebugParams.TraceReuseTolerance);
+
+	int32 NumReused = 0;
+	for (int WheelIdx = 0; WheelIdx < SuspensionTrace.Num(); WheelIdx++)
+	{
+		const Chaos::FSuspensionTrace& Trace = SuspensionTrace[WheelIdx];
+		const Chaos::FSuspensionTrace& CachedTrace = WheelState.CachedTrace[WheelIdx];
+		FHitResult& HitResult = WheelState.TraceResult[WheelIdx];
+
+		bool bReused = false;
+
+		// only a hit on something that cannot move is safe to keep, a miss could be about to land on anything.
+		// Each reuse is reprojected against the original hit plane, but the trace can drift up to the tolerance from the one that made it,
+		// so the result is refreshed after a few steps in a row
+		if (GWheeledVehicleDebugParams.EnableTraceReuse && WheelState.CachedTraceReusable[WheelIdx]
+			&& WheelState.TraceReuseCount[WheelIdx] < GWheeledVehicleDebugParams.TraceReuseMaxSteps
+			&& FVector::DistSquared(Trace.Start, CachedTrace.Start) < ToleranceSq
+			&& FVector::DistSquared(Trace.End, CachedTrace.End) < ToleranceSq)
+		{
+			const float SweepRadius = (WheelTraceParams[WheelIdx].SweepShape == ESweepShape::Spherecast) ? PVehicle->Wheels[WheelIdx].GetEffectiveRadius() : 0.0f;
+			bReused = ReprojectTraceResult(HitResult, Trace, SweepRadius);
+		}
+
+		WheelState.TraceReused[WheelIdx] = bReused;
+		if (bReused)
+		{
+			WheelState.TraceReuseCount[WheelIdx]++;
+			NumReused++;
+		}
+		else
+		{
+			// about to be traced, the cached trace is compared against the original trace so reuse errors can't accumulate
+			WheelState.CachedTrace[WheelIdx] = Trace;
+			WheelState.CachedTraceReusable[WheelIdx] = false;	// decided once the trace has been made
+			WheelState.TraceReuseCount[WheelIdx] = 0;
+		}
+	}
+
+	return NumReused;
+}
+
+bool UChaosWheeledVehicleSimulation::ReprojectTraceResult(FHitResult& HitResult, const Chaos::FSuspensionTrace& Trace, float SweepRadius) const
+{
+	const FVector& PlanePoint = HitResult.ImpactPoint;
+	const FVector& PlaneNormal = HitResult.ImpactNormal;
+
+	// sphere sweeps start one radius back along the trace, matching PerformSuspensionTraces
+	const FVector TraceNormal = (Trace.Start - Trace.End).GetSafeNormal(); // reversed
+	const FVector Start = Trace.Start + TraceNormal * SweepRadius;
+	const FVector Delta = Trace.End - Start;
+
+	const float Approach = FVector::DotProduct(Delta, PlaneNormal);
+	if (Approach > -KINDA_SMALL_NUMBER)
+	{
+		// trace is parallel to or leaving the plane
+		return false;
+	}
+
+	// the point where the swept sphere (or ray when the radius is zero) touches the plane
+	const float Time = (SweepRadius - FVector::DotProduct(Start - PlanePoint, PlaneNormal)) / Approach;
+	if (Time < 0.0f || Time > 1.0f)
+	{
+		return false;
+	}
+
+	const FVector Location = Start + Delta * Time;
+	HitResult.Time = Time;
+	HitResult.Distance = Delta.Size() * Time;
+	HitResult.Location = Location;
+	HitResult.ImpactPoint = Location - PlaneNormal * SweepRadius;
+	HitResult.TraceStart = Start;
+	HitResult.TraceEnd = Trace.End;
+
+	return true;
+}
+
+void UChaosWheeledVehicleSimulation::PerformSuspensionTraces(const TArray<Chaos::FSuspensionTrace>& SuspensionTrace, const FVehicleTraceQueryParams& QueryParams)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ChaosVehicle_SuspensionRaycasts);
 
+	const TArray<FWheelTraceParams>& WheelTraceParams = QueryParams.WheelTraceParams;
+
+	if (ReuseSuspensionTraces(SuspensionTrace, WheelTraceParams) == SuspensionTrace.Num())
+	{
+		return;
+	}
+
 	ECollisionChannel SpringCollisionChannel = ECollisionChannel::ECC_WorldDynamic;
 	FCollisionResponseParams ResponseParams;
-	ResponseParams.CollisionResponse = CollisionResponse;
+	ResponseParams.CollisionResponse = QueryParams.TraceCollisionResponse;
 
 	// batching is about 0.5ms (25%) faster when there's 100 vehicles on a flat terrain
 	if (GVehicleDebugParams.BatchQueries)
 	{
-		if (!GVehicleDebugParams.CacheTraceOverlap || !ContainsTraces(QueryBox, SuspensionTrace))
+		// complex collision is only needed when a wheel is going to trace against it
+		bool bAnyWheelTraceComplex = false;
+		for (int WheelIdx = 0; WheelIdx < SuspensionTrace.Num() && !bAnyWheelTraceComplex; WheelIdx++)
+		{
+			bAnyWheelTraceComplex = IsWheelTraceComplex(WheelTraceParams[WheelIdx]);
+		}
+
+		const bool bCacheValid = GVehicleDebugParams.CacheTraceOverlap && bOverlapTraceComplex == bAnyWheelTraceComplex && ContainsTraces(QueryBox, SuspensionTrace);
+		if (GVehicleDebugParams.CacheTraceOverlap)
+		{
+			if (bCacheValid)
+			{
+				INC_DWORD_STAT(STAT_ChaosVehicle_OverlapCacheHits);
+			}
+			else
+			{
+				INC_DWORD_STAT(STAT_ChaosVehicle_OverlapCacheMisses);
+			}
+		}
+
+		if (!bCacheValid)
 		{
 			SCOPE_CYCLE_COUNTER(STAT_ChaosVehicle_SuspensionOverlapTest);
 
 			bOverlapHit = false;
-			OverlapResults.Empty();
+			OverlapResults.Reset();
 			QueryBox.Init();
 
 			//FBox QueryBox;
@@ -356,10 +607,25 @@ void UChaosWheeledVehicleSimulation::PerformSuspensionTraces(const TArray<Chaos:
 				}
 			}
 			QueryBox = QueryBox.ExpandBy(FVector(GWheeledVehicleDebugParams.OverlapTestExpansionXY, GWheeledVehicleDebugParams.OverlapTestExpansionXY, GWheeledVehicleDebugParams.OverlapTestExpansionZ));
+
+			// sweep the cached box along where the vehicle is heading so fast vehicles still get a few steps out of it
+			if (GVehicleDebugParams.CacheTraceOverlap)
+			{
+				const FVector Prediction = (VehicleState.VehicleWorldVelocity * GWheeledVehicleDebugParams.OverlapCachePredictionTime).GetClampedToMaxSize(GWheeledVehicleDebugParams.OverlapCacheMaxPrediction);
+				QueryBox += QueryBox.ShiftBy(Prediction);
+			}
 			FCollisionShape CollisionBox;
 			CollisionBox.SetBox((FVector3f)QueryBox.GetExtent());
 
-			bOverlapHit = World->OverlapMultiByChannel(OverlapResults, QueryBox.GetCenter(), FQuat::Identity, SpringCollisionChannel, CollisionBox, TraceParams, ResponseParams);
+			bOverlapTraceComplex = bAnyWheelTraceComplex;
+			bOverlapHit = World->OverlapMultiByChannel(OverlapResults, QueryBox.GetCenter(), FQuat::Identity, SpringCollisionChannel, CollisionBox, QueryParams.GetTraceParams(bAnyWheelTraceComplex), ResponseParams);
+
+			OverlapBounds.Reset(OverlapResults.Num());
+			for (const FOverlapResult& OverlapResult : OverlapResults)
+			{
+				const UPrimitiveComponent* Component = OverlapResult.Component.Get();
+				OverlapBounds.Add(Component ? Component->Bounds.GetBox() : FBox(ForceInit));
+			}
 		}
 		
 	#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -368,7 +634,7 @@ void UChaosWheeledVehicleSimulation::PerformSuspensionTraces(const TArray<Chaos:
 			Chaos::FDebugDrawQueue::GetInstance().DrawDebugBox(QueryBox.GetCenter(), QueryBox.GetExtent(), FQuat::Identity, FColor::Yellow, false, -1.0f, 0, 2.0f);
 
 			// draw all corresponding results bounding boxes
-			for (FOverlapResult OverlapResult : OverlapResults)
+			for (const FOverlapResult& OverlapResult : OverlapResults)
 			{
 				if (OverlapResult.bBlockingHit)
 				{
@@ -380,67 +646,103 @@ void UChaosWheeledVehicleSimulation::PerformSuspensionTraces(const TArray<Chaos:
 	#endif
 
 		SCOPE_CYCLE_COUNTER(STAT_ChaosVehicle_SuspensionTraces);
-		for (int32 WheelIdx = 0; WheelIdx < SuspensionTrace.Num(); ++WheelIdx)
+		const int32 NumTraces = SuspensionTrace.Num();
+		for (int32 WheelIdx = 0; WheelIdx < NumTraces; ++WheelIdx)
 		{
-			FHitResult& HitResult = WheelState.TraceResult[WheelIdx];
-			HitResult = FHitResult();
+			if (!WheelState.TraceReused[WheelIdx])
+			{
+				WheelState.TraceResult[WheelIdx] = FHitResult();
+			}
+		}
 
-			if (bOverlapHit)
+		if (bOverlapHit)
+		{
+			auto TraceWheel = [this, &SuspensionTrace, &QueryParams, &WheelTraceParams](int32 WheelIdx, UPrimitiveComponent* Component)
 			{
+				FHitResult& HitResult = WheelState.TraceResult[WheelIdx];
 				const FVector& TraceStart = SuspensionTrace[WheelIdx].Start;
 				const FVector& TraceEnd = SuspensionTrace[WheelIdx].End;
-				TraceParams.bTraceComplex = (WheelTraceParams[WheelIdx].SweepType == ESweepType::ComplexSweep);
+				const float WheelRadius = PVehicle->Wheels[WheelIdx].GetEffectiveRadius();
+				const bool bSpherecast = (WheelTraceParams[WheelIdx].SweepShape == ESweepShape::Spherecast);
+				const bool bTraceComplex = IsWheelTraceComplex(WheelTraceParams[WheelIdx]);
 
-				if (GWheeledVehicleDebugParams.TraceTypeOverride > 0)
+				FHitResult ComponentHit;
+				bool bHit = false;
+
+				// landscape is sampled directly, anything it can't resolve falls through to the generic trace
+				if (GWheeledVehicleDebugParams.EnableHeightfieldContacts && FHeightfieldContactProvider::Trace(Component, TraceStart, TraceEnd, bSpherecast ? WheelRadius : 0.0f, ComponentHit))
 				{
-					TraceParams.bTraceComplex = GWheeledVehicleDebugParams.TraceTypeOverride == 2;
+					bHit = ComponentHit.bBlockingHit;
 				}
-
-				FVector TraceVector(TraceStart - TraceEnd); // reversed
-				FVector TraceNormal = TraceVector.GetSafeNormal();
-
-				// Test each overlapped object for a hit result
-				for (FOverlapResult OverlapResult : OverlapResults)
+				else if (bSpherecast)
 				{
-					if (!OverlapResult.bBlockingHit)
-						continue;
+					FVector TraceNormal = (TraceStart - TraceEnd).GetSafeNormal(); // reversed
+					FVector Start = TraceStart + TraceNormal * WheelRadius;
+					bHit = Component->SweepComponent(ComponentHit, Start, TraceEnd, FQuat::Identity, FCollisionShape::MakeSphere(WheelRadius), bTraceComplex);
+				}
+				else
+				{
+					bHit = Component->LineTraceComponent(ComponentHit, TraceStart, TraceEnd, QueryParams.GetTraceParams(bTraceComplex));
+				}
 
-					FHitResult ComponentHit;
+				if (bHit && ComponentHit.Time < HitResult.Time)
+				{
+					HitResult = ComponentHit;
+					HitResult.bBlockingHit = true;
+				}
+			};
 
-					switch (WheelTraceParams[WheelIdx].SweepShape)
-					{
-					case ESweepShape::Spherecast:
+			// pack the trace bounds four wheels at a time, reused wheels and padding lanes never overlap anything
+			TArray<ChaosVehicleNarrowPhase::FTraceBounds4, TInlineAllocator<4>> TraceBounds;
+			TraceBounds.SetNumUninitialized((NumTraces + 3) / 4);
+			for (int32 Group = 0; Group < TraceBounds.Num(); Group++)
+			{
+				FBox Bounds[4];
+				for (int32 Lane = 0; Lane < 4; Lane++)
+				{
+					const int32 WheelIdx = Group * 4 + Lane;
+					if (WheelIdx < NumTraces && !WheelState.TraceReused[WheelIdx])
 					{
-						float WheelRadius = PVehicle->Wheels[WheelIdx].GetEffectiveRadius();
-						FVector VehicleUpAxis = TraceNormal;
-
-						FVector Start = TraceStart + VehicleUpAxis * WheelRadius;
-						FVector End = TraceEnd;
+						const FVector& TraceStart = SuspensionTrace[WheelIdx].Start;
+						const FVector& TraceEnd = SuspensionTrace[WheelIdx].End;
 
-						if (OverlapResult.Component->SweepComponent(ComponentHit, Start, End, FQuat::Identity, FCollisionShape::MakeSphere(WheelRadius), TraceParams.bTraceComplex))
+						// sphere sweeps start a wheel radius back along the trace, see TraceWheel
+						float SweepRadius = 0.0f;
+						FVector SweepStart = TraceStart;
+						if (WheelTraceParams[WheelIdx].SweepShape == ESweepShape::Spherecast)
 						{
-							if (ComponentHit.Time < HitResult.Time)
-							{
-								HitResult = ComponentHit;
-								HitResult.bBlockingHit = OverlapResult.bBlockingHit;
-							}
+							SweepRadius = PVehicle->Wheels[WheelIdx].GetEffectiveRadius();
+							SweepStart += (TraceStart - TraceEnd).GetSafeNormal() * SweepRadius;
 						}
+						Bounds[Lane] = FBox(SweepStart.ComponentMin(TraceEnd), SweepStart.ComponentMax(TraceEnd)).ExpandBy(SweepRadius);
 					}
-					break;
-
-					case ESweepShape::Raycast:
-					default:
+					else
 					{
-						if (OverlapResult.Component->LineTraceComponent(ComponentHit, TraceStart, TraceEnd, TraceParams))
-						{
-							if (ComponentHit.Time < HitResult.Time)
-							{
-								HitResult = ComponentHit;
-								HitResult.bBlockingHit = OverlapResult.bBlockingHit;
-							}
-						}
+						Bounds[Lane] = FBox(FVector(BIG_NUMBER), FVector(-BIG_NUMBER));
 					}
-					break;
+				}
+				TraceBounds[Group] = ChaosVehicleNarrowPhase::FTraceBounds4(Bounds);
+			}
+
+			// test each overlapped object against all of the wheels at once, only tracing the wheels that can possibly hit it
+			for (int32 OverlapIdx = 0; OverlapIdx < OverlapResults.Num(); OverlapIdx++)
+			{
+				const FOverlapResult& OverlapResult = OverlapResults[OverlapIdx];
+				UPrimitiveComponent* Component = OverlapResult.Component.Get();
+				if (!OverlapResult.bBlockingHit || Component == nullptr)
+					continue;
+
+				// bounds of anything that can move have to be refreshed, static ones are good for as long as the overlap is cached
+				const FBox ComponentBounds = (Component->Mobility == EComponentMobility::Static) ? OverlapBounds[OverlapIdx] : Component->Bounds.GetBox();
+
+				for (int32 Group = 0; Group < TraceBounds.Num(); Group++)
+				{
+					uint32 WheelMask = TraceBounds[Group].OverlapMask(ComponentBounds);
+					while (WheelMask)
+					{
+						const int32 Lane = FMath::CountTrailingZeros(WheelMask);
+						WheelMask &= WheelMask - 1;
+						TraceWheel(Group * 4 + Lane, Component);
 					}
 				}
 			}
@@ -451,16 +753,16 @@ void UChaosWheeledVehicleSimulation::PerformSuspensionTraces(const TArray<Chaos:
 		SCOPE_CYCLE_COUNTER(STAT_ChaosVehicle_SuspensionTraces);
 		for (int WheelIdx = 0; WheelIdx < SuspensionTrace.Num(); WheelIdx++)
 		{
+			if (WheelState.TraceReused[WheelIdx])
+			{
+				continue;
+			}
+
 			FHitResult& HitResult = WheelState.TraceResult[WheelIdx];
 
 			FVector TraceStart = SuspensionTrace[WheelIdx].Start;
 			FVector TraceEnd = SuspensionTrace[WheelIdx].End;
-			TraceParams.bTraceComplex = (WheelTraceParams[WheelIdx].SweepType == ESweepType::ComplexSweep);
-
-			if (GWheeledVehicleDebugParams.TraceTypeOverride > 0)
-			{
-				TraceParams.bTraceComplex = GWheeledVehicleDebugParams.TraceTypeOverride == 2;
-			}
+			const FCollisionQueryParams& TraceParams = QueryParams.GetTraceParams(IsWheelTraceComplex(WheelTraceParams[WheelIdx]));
 
 			FVector TraceVector(TraceStart - TraceEnd); // reversed
 			FVector TraceNormal = TraceVector.GetSafeNormal();
@@ -499,6 +801,12 @@ void UChaosWheeledVehicleSimulation::ApplyWheelFrictionForces(float DeltaTime)
 {
 	using namespace Chaos;
 
+	if (GWheeledVehicleDebugParams.EnableVectorWheelFrames)
+	{
+		ApplyWheelFrictionForcesVectorized(DeltaTime);
+		return;
+	}
+
 	for (int WheelIdx = 0; WheelIdx < PVehicle->Wheels.Num(); WheelIdx++)
 	{
 		auto& PWheel = PVehicle->Wheels[WheelIdx]; // Physics Wheel
@@ -539,50 +847,215 @@ void UChaosWheeledVehicleSimulation::ApplyWheelFrictionForces(float DeltaTime)
 			{
 				AddForceAtPosition(FrictionForceVector, HitResult.ImpactPoint);
 			}
-		
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-			if (GWheeledVehicleDebugParams.ShowWheelForces)
+
+			DrawWheelFrictionForces(WheelIdx, Mat, FrictionForceVector);
+		}
+		else
+		{
+			PWheel.SetVehicleGroundSpeed(FVector::ZeroVector);
+			PWheel.SetWheelLoadForce(0.f);
+			PWheel.Simulate(DeltaTime);
+		}
+
+	}
+}
+
+namespace ChaosVehicleWheelFrames
+{
+	/** Per wheel values of four wheels, one array per vector component so each loads straight into a register */
+	struct FWheelLanes
+	{
+		float SteeringAngle[4] = { 0.f, 0.f, 0.f, 0.f };
+		float X[4] = { 0.f, 0.f, 0.f, 0.f };
+		float Y[4] = { 0.f, 0.f, 0.f, 0.f };
+		float Z[4] = { 0.f, 0.f, 0.f, 0.f };
+		float NormalX[4] = { 0.f, 0.f, 0.f, 0.f };
+		float NormalY[4] = { 0.f, 0.f, 0.f, 0.f };
+		float NormalZ[4] = { 1.f, 1.f, 1.f, 1.f };
+	};
+
+	/** Rotate four vectors about Z by the angles with the given sines and cosines, the same as a yaw only FRotator */
+	FORCEINLINE void RotateAboutZ(VectorRegister4Float& X, VectorRegister4Float& Y, const VectorRegister4Float& Sin, const VectorRegister4Float& Cos)
+	{
+		const VectorRegister4Float RotatedX = VectorSubtract(VectorMultiply(X, Cos), VectorMultiply(Y, Sin));
+		Y = VectorMultiplyAdd(X, Sin, VectorMultiply(Y, Cos));
+		X = RotatedX;
+	}
+
+	/** Cross product of four pairs of vectors */
+	FORCEINLINE void CrossProduct(const VectorRegister4Float& AX, const VectorRegister4Float& AY, const VectorRegister4Float& AZ
+		, const VectorRegister4Float& BX, const VectorRegister4Float& BY, const VectorRegister4Float& BZ
+		, VectorRegister4Float& OutX, VectorRegister4Float& OutY, VectorRegister4Float& OutZ)
+	{
+		OutX = VectorSubtract(VectorMultiply(AY, BZ), VectorMultiply(AZ, BY));
+		OutY = VectorSubtract(VectorMultiply(AZ, BX), VectorMultiply(AX, BZ));
+		OutZ = VectorSubtract(VectorMultiply(AX, BY), VectorMultiply(AY, BX));
+	}
+}
+
+void UChaosWheeledVehicleSimulation::ApplyWheelFrictionForcesVectorized(float DeltaTime)
+{
+	using namespace Chaos;
+	using namespace ChaosVehicleWheelFrames;
+
+	const int32 NumWheels = PVehicle->Wheels.Num();
+
+	const VectorRegister4Float RightX = VectorSetFloat1((float)VehicleState.VehicleRightAxis.X);
+	const VectorRegister4Float RightY = VectorSetFloat1((float)VehicleState.VehicleRightAxis.Y);
+	const VectorRegister4Float RightZ = VectorSetFloat1((float)VehicleState.VehicleRightAxis.Z);
+
+	for (int32 FirstWheel = 0; FirstWheel < NumWheels; FirstWheel += 4)
+	{
+		const int32 NumLanes = FMath::Min(4, NumWheels - FirstWheel);
+		FWheelLanes Lanes;
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			const FVector& LocalWheelVelocity = WheelState.LocalWheelVelocity[FirstWheel + Lane];
+			Lanes.SteeringAngle[Lane] = FMath::DegreesToRadians(PVehicle->Wheels[FirstWheel + Lane].SteeringAngle);
+			Lanes.X[Lane] = (float)LocalWheelVelocity.X;
+			Lanes.Y[Lane] = (float)LocalWheelVelocity.Y;
+			Lanes.Z[Lane] = (float)LocalWheelVelocity.Z;
+		}
+
+		VectorRegister4Float SteeringSin, SteeringCos;
+		const VectorRegister4Float SteeringAngle = VectorLoad(Lanes.SteeringAngle);
+		VectorSinCos(&SteeringSin, &SteeringCos, &SteeringAngle);
+
+		// take into account steering angle, the ground speed is in the steered wheel's frame
+		VectorRegister4Float X = VectorLoad(Lanes.X);
+		VectorRegister4Float Y = VectorLoad(Lanes.Y);
+		RotateAboutZ(X, Y, VectorNegate(SteeringSin), SteeringCos);
+		VectorStore(X, Lanes.X);
+		VectorStore(Y, Lanes.Y);
+
+		// the wheel simulation itself is scalar, the lanes are reused for its friction forces
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			auto& PWheel = PVehicle->Wheels[FirstWheel + Lane]; // Physics Wheel
+			const FHitResult& HitResult = WheelState.TraceResult[FirstWheel + Lane];
+
+			if (PWheel.InContact())
 			{
-				// show longitudinal drive force
-				if (PWheel.AvailableGrip > 0.0f)
+				if (HitResult.PhysMaterial.IsValid())
 				{
-					float Radius = 50.0f;
-					float Scaling = 50.0f / PWheel.AvailableGrip;
+					PWheel.SetSurfaceFriction(HitResult.PhysMaterial->Friction);
+				}
 
-					FVector Center = WheelState.WheelWorldLocation[WheelIdx];			
-					FVector Offset(0.0f, WheelState.WheelLocalLocation[WheelIdx].Y, 10.f);
-					Offset = Mat.TransformVector(Offset);
+				PWheel.SetVehicleGroundSpeed(FVector(Lanes.X[Lane], Lanes.Y[Lane], Lanes.Z[Lane]));
+				PWheel.Simulate(DeltaTime);
 
-					FDebugDrawQueue::GetInstance().DrawDebugLine(Center, Center + GroundZVector * 100.f, FColor::Orange, false, -1.0f, 0, 2);
+				const FVector FrictionForceLocal = PWheel.GetForceFromFriction();
+				Lanes.X[Lane] = (float)FrictionForceLocal.X;
+				Lanes.Y[Lane] = (float)FrictionForceLocal.Y;
+				Lanes.Z[Lane] = (float)FrictionForceLocal.Z;
+				Lanes.NormalX[Lane] = (float)HitResult.Normal.X;
+				Lanes.NormalY[Lane] = (float)HitResult.Normal.Y;
+				Lanes.NormalZ[Lane] = (float)HitResult.Normal.Z;
+			}
+			else
+			{
+				PWheel.SetVehicleGroundSpeed(FVector::ZeroVector);
+				PWheel.SetWheelLoadForce(0.f);
+				PWheel.Simulate(DeltaTime);
 
-					Center += Offset;
-					FVector InputForceVectorWorld = Mat.TransformVector(PWheel.InputForces);
-					FDebugDrawQueue::GetInstance().DrawDebugCircle(Center, Radius, 60, FColor::White, false, -1.0f, 0, 3, FVector(1,0,0), FVector(0,1,0), false);
-					FDebugDrawQueue::GetInstance().DrawDebugLine(Center, Center + InputForceVectorWorld * Scaling, (PWheel.bClipping?FColor::Red:FColor::Green), false, -1.0f, 0, PWheel.bClipping?2:4);
-					FDebugDrawQueue::GetInstance().DrawDebugLine(Center, Center + FrictionForceVector * Scaling, FColor::Yellow, false, -1.0f, 1, PWheel.bClipping?4:2);
+				Lanes.X[Lane] = Lanes.Y[Lane] = Lanes.Z[Lane] = 0.f;
+			}
+		}
 
-				}
+		// friction out of the steered wheel's frame
+		X = VectorLoad(Lanes.X);
+		Y = VectorLoad(Lanes.Y);
+		const VectorRegister4Float Z = VectorLoad(Lanes.Z);
+		RotateAboutZ(X, Y, SteeringSin, SteeringCos);
+
+		// then out of the ground contact frame into world space
+		const VectorRegister4Float GroundZX = VectorLoad(Lanes.NormalX);
+		const VectorRegister4Float GroundZY = VectorLoad(Lanes.NormalY);
+		const VectorRegister4Float GroundZZ = VectorLoad(Lanes.NormalZ);
+
+		VectorRegister4Float GroundXX, GroundXY, GroundXZ;
+		CrossProduct(RightX, RightY, RightZ, GroundZX, GroundZY, GroundZZ, GroundXX, GroundXY, GroundXZ);
+
+		VectorRegister4Float GroundYX, GroundYY, GroundYZ;
+		CrossProduct(GroundZX, GroundZY, GroundZZ, GroundXX, GroundXY, GroundXZ, GroundYX, GroundYY, GroundYZ);
 
+		VectorStore(VectorMultiplyAdd(Z, GroundZX, VectorMultiplyAdd(Y, GroundYX, VectorMultiply(X, GroundXX))), Lanes.X);
+		VectorStore(VectorMultiplyAdd(Z, GroundZY, VectorMultiplyAdd(Y, GroundYY, VectorMultiply(X, GroundXY))), Lanes.Y);
+		VectorStore(VectorMultiplyAdd(Z, GroundZZ, VectorMultiplyAdd(Y, GroundYZ, VectorMultiply(X, GroundXZ))), Lanes.Z);
+
+		for (int32 Lane = 0; Lane < NumLanes; Lane++)
+		{
+			const int32 WheelIdx = FirstWheel + Lane;
+			if (!PVehicle->Wheels[WheelIdx].InContact())
+			{
+				continue;
 			}
-#endif
 
+			const FVector FrictionForceVector(Lanes.X[Lane], Lanes.Y[Lane], Lanes.Z[Lane]);
+			if (PVehicle->bLegacyWheelFrictionPosition)
+			{
+				AddForceAtPosition(FrictionForceVector, WheelState.WheelWorldLocation[WheelIdx]);
+			}
+			else
+			{
+				AddForceAtPosition(FrictionForceVector, WheelState.TraceResult[WheelIdx].ImpactPoint);
+			}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+			if (GWheeledVehicleDebugParams.ShowWheelForces)
+			{
+				const FVector GroundZVector = WheelState.TraceResult[WheelIdx].Normal;
+				const FVector GroundXVector = FVector::CrossProduct(VehicleState.VehicleRightAxis, GroundZVector);
+				const FVector GroundYVector = FVector::CrossProduct(GroundZVector, GroundXVector);
+
+				DrawWheelFrictionForces(WheelIdx, FMatrix(GroundXVector, GroundYVector, GroundZVector, VehicleState.VehicleWorldTransform.GetLocation()), FrictionForceVector);
+			}
+#endif
 		}
-		else
+	}
+}
+
+void UChaosWheeledVehicleSimulation::DrawWheelFrictionForces(int WheelIdx, const FMatrix& GroundFrame, const FVector& FrictionForceVector)
+{
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	using namespace Chaos;
+
+	const auto& PWheel = PVehicle->Wheels[WheelIdx];
+
+	if (GWheeledVehicleDebugParams.ShowWheelForces)
+	{
+		// show longitudinal drive force
+		if (PWheel.AvailableGrip > 0.0f)
 		{
-			PWheel.SetVehicleGroundSpeed(FVector::ZeroVector);
-			PWheel.SetWheelLoadForce(0.f);
-			PWheel.Simulate(DeltaTime);
+			float Radius = 50.0f;
+			float Scaling = 50.0f / PWheel.AvailableGrip;
+
+			FVector Center = WheelState.WheelWorldLocation[WheelIdx];			
+			FVector Offset(0.0f, WheelState.WheelLocalLocation[WheelIdx].Y, 10.f);
+			Offset = GroundFrame.TransformVector(Offset);
+
+			FDebugDrawQueue::GetInstance().DrawDebugLine(Center, Center + GroundFrame.GetScaledAxis(EAxis::Z) * 100.f, FColor::Orange, false, -1.0f, 0, 2);
+
+			Center += Offset;
+			FVector InputForceVectorWorld = GroundFrame.TransformVector(PWheel.InputForces);
+			FDebugDrawQueue::GetInstance().DrawDebugCircle(Center, Radius, 60, FColor::White, false, -1.0f, 0, 3, FVector(1,0,0), FVector(0,1,0), false);
+			FDebugDrawQueue::GetInstance().DrawDebugLine(Center, Center + InputForceVectorWorld * Scaling, (PWheel.bClipping?FColor::Red:FColor::Green), false, -1.0f, 0, PWheel.bClipping?2:4);
+			FDebugDrawQueue::GetInstance().DrawDebugLine(Center, Center + FrictionForceVector * Scaling, FColor::Yellow, false, -1.0f, 1, PWheel.bClipping?4:2);
+
 		}
 
 	}
+#endif
 }
 
-void UChaosWheeledVehicleSimulation::ApplySuspensionForces(float DeltaTime, TArray<FWheelTraceParams>& WheelTraceParams)
+void UChaosWheeledVehicleSimulation::ApplySuspensionForces(float DeltaTime, const TArray<FWheelTraceParams>& WheelTraceParams)
 {
 	using namespace Chaos;
 
-	TArray<float> SusForces;
-	SusForces.Init(0.f, PVehicle->Suspension.Num());
+	// sized with the wheel state, so this doesn't allocate in steady state
+	TArray<float>& SusForces = WheelState.WheelLoad;
+	SusForces.SetNum(PVehicle->Suspension.Num(), false);
 
 	for (int WheelIdx = 0; WheelIdx < SusForces.Num(); WheelIdx++)
 	{
@@ -672,6 +1145,7 @@ void UChaosWheeledVehicleSimulation::ApplySuspensionForces(float DeltaTime, TArr
 		{
 			PSuspension.SetSuspensionLength(PSuspension.GetTraceLength(PWheel.GetEffectiveRadius()), PWheel.Setup().WheelRadius);
 			PWheel.SetWheelLoadForce(0.f);
+			SusForces[WheelIdx] = 0.f;
 
 		}
 
@@ -1044,10 +1518,11 @@ void UChaosWheeledVehicleSimulation::FillOutputState(FChaosVehicleAsyncOutput& O
 		Output.VehicleSimOutput.EngineTorque = Engine.GetEngineTorque();
 	}
 
-	// #TODO: can we avoid copies when async is turned off
+	// pooled outputs keep their wheel storage between steps, so this only allocates the first time an output is used
+	Output.VehicleSimOutput.Wheels.SetNum(VehicleWheels.Num(), false);
 	for (int WheelIdx = 0; WheelIdx < VehicleWheels.Num(); WheelIdx++)
 	{
-		FWheelsOutput WheelsOut;
+		FWheelsOutput& WheelsOut = Output.VehicleSimOutput.Wheels[WheelIdx];
 		WheelsOut.InContact = VehicleWheels[WheelIdx].InContact();
 		WheelsOut.SteeringAngle = VehicleWheels[WheelIdx].GetSteeringAngle();
 		WheelsOut.AngularPosition = VehicleWheels[WheelIdx].GetAngularPosition();
@@ -1068,24 +1543,119 @@ void UChaosWheeledVehicleSimulation::FillOutputState(FChaosVehicleAsyncOutput& O
 		WheelsOut.SpringForce = VehicleSuspension[WheelIdx].GetSuspensionForce();
 		WheelsOut.NormalizedSuspensionLength = VehicleSuspension[WheelIdx].GetNormalizedLength();
 
-		WheelsOut.DriveTorque = Chaos::TorqueCmToM(VehicleWheels[WheelIdx].GetDriveTorque());
-		WheelsOut.BrakeTorque = Chaos::TorqueCmToM(VehicleWheels[WheelIdx].GetBrakeTorque());
+		WheelsOut.DriveTorque = Chaos::TorqueCmToM(VehicleWheels[WheelIdx].GetDriveTorque());
+		WheelsOut.BrakeTorque = Chaos::TorqueCmToM(VehicleWheels[WheelIdx].GetBrakeTorque());
+
+		WheelsOut.bABSActivated = VehicleWheels[WheelIdx].IsABSActivated();
+		WheelsOut.bBlockingHit = WheelState.TraceResult[WheelIdx].bBlockingHit;
+		WheelsOut.ImpactPoint = WheelState.TraceResult[WheelIdx].ImpactPoint;
+		WheelsOut.HitLocation = WheelState.TraceResult[WheelIdx].Location;
+		WheelsOut.PhysMaterial = WheelState.TraceResult[WheelIdx].PhysMaterial;
+	}
+
+}
+
+void UChaosWheeledVehicleSimulation::UpdateConstraintHandles(TArray<FPhysicsConstraintHandle>& ConstraintHandlesIn)
+{
+	UChaosVehicleSimulation::UpdateConstraintHandles(ConstraintHandlesIn);
+	ConstraintHandles = ConstraintHandlesIn;
+}
+
+TUniquePtr<UChaosVehicleSimulation> UChaosWheeledVehicleSimulation::Clone() const
+{
+	TUniquePtr<UChaosWheeledVehicleSimulation> Simulation = MakeUnique<UChaosWheeledVehicleSimulation>();
+	CloneVehicle(*Simulation);
+	Simulation->WheelState.Init(Simulation->PVehicle->Wheels.Num());
+	return Simulation;
+}
+
+void UChaosWheeledVehicleSimulation::ResetSimulation()
+{
+	UChaosVehicleSimulation::ResetSimulation();
+
+	if (PVehicle.IsValid())
+	{
+		WheelState.Init(PVehicle->Wheels.Num());
+	}
+
+	OverlapResults.Reset();
+	OverlapBounds.Reset();
+	bOverlapHit = false;
+	bOverlapTraceComplex = false;
+	QueryBox.Init();
+	bSuspensionTracesBatched = false;
+}
+
+void UChaosWheeledVehicleSimulation::ApplyTuningPatch(const FVehicleTuningPatch& InPatch)
+{
+	UChaosVehicleSimulation::ApplyTuningPatch(InPatch);
+
+	if (!PVehicle.IsValid())
+	{
+		return;
+	}
+
+	const FWheeledVehicleTuningPatch& Patch = static_cast<const FWheeledVehicleTuningPatch&>(InPatch);
+
+	if (PVehicle->Engine.Num() > 0)
+	{
+		PVehicle->Engine[0].AccessSetup() = Patch.Engine;
+	}
+
+	if (PVehicle->Transmission.Num() > 0)
+	{
+		PVehicle->Transmission[0].AccessSetup() = Patch.Transmission;
+	}
+
+	if (PVehicle->Differential.Num() > 0)
+	{
+		PVehicle->Differential[0].AccessSetup() = Patch.Differential;
+	}
+
+	if (PVehicle->Steering.Num() > 0)
+	{
+		PVehicle->Steering[0].AccessSetup() = Patch.Steering;
+	}
+
+	PVehicle->bLegacyWheelFrictionPosition = Patch.bLegacyWheelFrictionPosition;
+
+	if (Patch.Wheels.Num() != PVehicle->Wheels.Num() || Patch.Suspension.Num() != PVehicle->Suspension.Num())
+	{
+		return;
+	}
+
+	for (int WheelIdx = 0; WheelIdx < PVehicle->Wheels.Num(); WheelIdx++)
+	{
+		Chaos::FSimpleWheelSim& Wheel = PVehicle->Wheels[WheelIdx];
+		const Chaos::FSimpleWheelConfig& WheelSetup = Patch.Wheels[WheelIdx];
+
+		// values overridden at runtime are kept unless the setup they were initialized from has changed
+		if (Wheel.Setup().EngineEnabled != WheelSetup.EngineEnabled)
+		{
+			Wheel.EngineEnabled = WheelSetup.EngineEnabled;
+		}
+
+		const bool bRadiusChanged = Wheel.Setup().WheelRadius != WheelSetup.WheelRadius;
+		Wheel.AccessSetup() = WheelSetup;
 
-		WheelsOut.bABSActivated = VehicleWheels[WheelIdx].IsABSActivated();
-		WheelsOut.bBlockingHit = WheelState.TraceResult[WheelIdx].bBlockingHit;
-		WheelsOut.ImpactPoint = WheelState.TraceResult[WheelIdx].ImpactPoint;
-		WheelsOut.HitLocation = WheelState.TraceResult[WheelIdx].Location;
-		WheelsOut.PhysMaterial = WheelState.TraceResult[WheelIdx].PhysMaterial;
+		if (bRadiusChanged)
+		{
+			Wheel.SetWheelRadius(WheelSetup.WheelRadius);
+		}
+	}
 
-		Output.VehicleSimOutput.Wheels.Add(WheelsOut);
+	for (int WheelIdx = 0; WheelIdx < PVehicle->Suspension.Num(); WheelIdx++)
+	{
+		PVehicle->Suspension[WheelIdx].AccessSetup() = Patch.Suspension[WheelIdx];
+		PVehicle->Suspension[WheelIdx].SetLocalRestingPosition(Patch.SuspensionRestingPositions[WheelIdx]);
 	}
 
-}
+	for (int AxleIdx = 0; AxleIdx < PVehicle->Axles.Num() && AxleIdx < Patch.RollbarScaling.Num(); AxleIdx++)
+	{
+		PVehicle->Axles[AxleIdx].Setup.RollbarScaling = Patch.RollbarScaling[AxleIdx];
+	}
 
-void UChaosWheeledVehicleSimulation::UpdateConstraintHandles(TArray<FPhysicsConstraintHandle>& ConstraintHandlesIn)
-{
-	UChaosVehicleSimulation::UpdateConstraintHandles(ConstraintHandlesIn);
-	ConstraintHandles = ConstraintHandlesIn;
+	PVehicle->NumDrivenWheels = Patch.NumDrivenWheels;
 }
 
 /**
@@ -1144,6 +1714,22 @@ void UChaosWheeledVehicleMovementComponent::PostEditChangeProperty(struct FPrope
 
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 }
+
+bool UChaosWheeledVehicleMovementComponent::RequiresVehicleRebuild(const FPropertyChangedEvent& PropertyChangedEvent) const
+{
+	if (Super::RequiresVehicleRebuild(PropertyChangedEvent))
+	{
+		return true;
+	}
+
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+
+	// the mechanical simulation is dropped when there is no torque curve, so editing the engine can add or remove it
+	return PropertyName == GET_MEMBER_NAME_CHECKED(UChaosWheeledVehicleMovementComponent, WheelSetups)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UChaosWheeledVehicleMovementComponent, bMechanicalSimEnabled)
+		|| (bMechanicalSimEnabled && EngineSetup.TorqueCurve.GetRichCurveConst()->IsEmpty())
+		|| (PropertyName == GET_MEMBER_NAME_CHECKED(UChaosWheeledVehicleMovementComponent, EngineSetup) && !bMechanicalSimEnabled);
+}
 #endif
 
 void UChaosWheeledVehicleMovementComponent::FixupSkeletalMesh()
@@ -1231,6 +1817,13 @@ void UChaosWheeledVehicleMovementComponent::FixupSkeletalMesh()
 
 }
 
+void UChaosWheeledVehicleMovementComponent::BakeCurves()
+{
+	Super::BakeCurves();
+
+	EngineSetup.BakeCurves();
+}
+
 
 bool UChaosWheeledVehicleMovementComponent::CanCreateVehicle() const
 {
@@ -1394,36 +1987,28 @@ void UChaosWheeledVehicleMovementComponent::SetupVehicle(TUniquePtr<Chaos::FSimp
 	Super::SetupVehicle(PVehicle);
 	NumDrivenWheels = 0;
 
+	// the wheel and suspension sims point into these so they must not be resized while the vehicle exists
+	VehicleSimulationPT->WheelConfigs.SetNum(WheelSetups.Num());
+	VehicleSimulationPT->SuspensionConfigs.SetNum(WheelSetups.Num());
+
 	// we are allowed any number of wheels not limited to only 4
 	for (int32 WheelIdx = 0; WheelIdx < WheelSetups.Num(); ++WheelIdx)
 	{
 		UChaosVehicleWheel* Wheel = WheelSetups[WheelIdx].WheelClass.GetDefaultObject();
+		TSharedPtr<const FChaosVehicleWheelSharedConfig> SharedConfig = UChaosVehicleWheel::GetSharedConfig(WheelSetups[WheelIdx].WheelClass);
+		check(SharedConfig);
 
-		// create Dynamic states passing in pointer to their Static setup data
-		Chaos::FSimpleWheelSim WheelSim(&Wheel->GetPhysicsWheelConfig());
+		// the differential and suspension setup below adjust the setup per vehicle so each vehicle holds its own copy
+		Chaos::FSimpleWheelConfig& WheelConfig = VehicleSimulationPT->WheelConfigs[WheelIdx];
+		WheelConfig = SharedConfig->WheelConfig;
 
-		if (Wheel->GetAxleType() != EAxleType::Undefined)
-		{
-			bool EngineEnable = false;
-			if (Wheel->GetAxleType() == EAxleType::Front)
-			{
-				if (DifferentialSetup.DifferentialType == EVehicleDifferential::AllWheelDrive
-					|| DifferentialSetup.DifferentialType == EVehicleDifferential::FrontWheelDrive)
-				{
-					EngineEnable = true;
-				}
-			}
-			else if (Wheel->GetAxleType() == EAxleType::Rear)
-			{
-				if (DifferentialSetup.DifferentialType == EVehicleDifferential::AllWheelDrive
-					|| DifferentialSetup.DifferentialType == EVehicleDifferential::RearWheelDrive)
-				{
-					EngineEnable = true;
-				}
-			}
+		Chaos::FSimpleSuspensionConfig& SuspensionConfig = VehicleSimulationPT->SuspensionConfigs[WheelIdx];
+		SuspensionConfig = SharedConfig->SuspensionConfig;
 
-			WheelSim.AccessSetup().EngineEnabled = EngineEnable;
-		}
+		// create Dynamic states passing in pointer to their Static setup data
+		Chaos::FSimpleWheelSim WheelSim(&WheelConfig);
+
+		SetupWheelEngineEnabled(WheelSim, Wheel);
 
 		WheelSim.SetWheelRadius(Wheel->WheelRadius); // initial radius
 		PVehicle->Wheels.Add(WheelSim);
@@ -1431,7 +2016,7 @@ void UChaosWheeledVehicleMovementComponent::SetupVehicle(TUniquePtr<Chaos::FSimp
 		FWheelsOutput WheelsOutput; // Receptacle for Data coming out of physics simulation on physics thread
 		PVehicleOutput->Wheels.Add(WheelsOutput);
 
-		Chaos::FSimpleSuspensionSim SuspensionSim(&Wheel->GetPhysicsSuspensionConfig());
+		Chaos::FSimpleSuspensionSim SuspensionSim(&SuspensionConfig);
 		PVehicle->Suspension.Add(SuspensionSim);
 
 		if (WheelSim.Setup().EngineEnabled)
@@ -1497,16 +2082,7 @@ void UChaosWheeledVehicleMovementComponent::SetupVehicle(TUniquePtr<Chaos::FSimp
 		PVehicle->Differential.Add(DifferentialSim);
 
 		// Setup override of wheel TorqueRatio & EngineEnabled from vehicle differential settings
-		for (int WheelIdx = 0; WheelIdx < PVehicle->Wheels.Num(); WheelIdx++)
-		{
-			FSimpleWheelSim& PWheel = PVehicle->Wheels[WheelIdx];
-			bool IsWheelPowered = FTransmissionUtility::IsWheelPowered(DifferentialSim.Setup().DifferentialType, PWheel.Setup().AxleType, PWheel.EngineEnabled);
-			PWheel.AccessSetup().EngineEnabled = IsWheelPowered;
-			PWheel.EngineEnabled = IsWheelPowered;
-
-			float TorqueRatio = FTransmissionUtility::GetTorqueRatioForWheel(DifferentialSim, WheelIdx, PVehicle->Wheels);
-			PWheel.AccessSetup().TorqueRatio = TorqueRatio;
-		}
+		SetupWheelTorqueRatios(PVehicle->Wheels, DifferentialSim);
 	}
 
 	Chaos::FSimpleSteeringSim SteeringSim(&SteeringSetup.GetPhysicsSteeringConfig(WheelTrackDimensions));
@@ -1531,6 +2107,193 @@ void UChaosWheeledVehicleMovementComponent::SetupVehicle(TUniquePtr<Chaos::FSimp
 	SetupSuspension(PVehicle);
 }
 
+void UChaosWheeledVehicleMovementComponent::SetupWheelEngineEnabled(Chaos::FSimpleWheelSim& WheelSim, UChaosVehicleWheel* Wheel) const
+{
+	if (Wheel->GetAxleType() != EAxleType::Undefined)
+	{
+		bool EngineEnable = false;
+		if (Wheel->GetAxleType() == EAxleType::Front)
+		{
+			if (DifferentialSetup.DifferentialType == EVehicleDifferential::AllWheelDrive
+				|| DifferentialSetup.DifferentialType == EVehicleDifferential::FrontWheelDrive)
+			{
+				EngineEnable = true;
+			}
+		}
+		else if (Wheel->GetAxleType() == EAxleType::Rear)
+		{
+			if (DifferentialSetup.DifferentialType == EVehicleDifferential::AllWheelDrive
+				|| DifferentialSetup.DifferentialType == EVehicleDifferential::RearWheelDrive)
+			{
+				EngineEnable = true;
+			}
+		}
+
+		WheelSim.AccessSetup().EngineEnabled = EngineEnable;
+	}
+}
+
+void UChaosWheeledVehicleMovementComponent::SetupWheelTorqueRatios(TArray<Chaos::FSimpleWheelSim>& WheelSims, const Chaos::FSimpleDifferentialSim& DifferentialSim) const
+{
+	using namespace Chaos;
+
+	for (int WheelIdx = 0; WheelIdx < WheelSims.Num(); WheelIdx++)
+	{
+		FSimpleWheelSim& PWheel = WheelSims[WheelIdx];
+		bool IsWheelPowered = FTransmissionUtility::IsWheelPowered(DifferentialSim.Setup().DifferentialType, PWheel.Setup().AxleType, PWheel.EngineEnabled);
+		PWheel.AccessSetup().EngineEnabled = IsWheelPowered;
+		PWheel.EngineEnabled = IsWheelPowered;
+
+		float TorqueRatio = FTransmissionUtility::GetTorqueRatioForWheel(DifferentialSim, WheelIdx, WheelSims);
+		PWheel.AccessSetup().TorqueRatio = TorqueRatio;
+	}
+}
+
+bool UChaosWheeledVehicleMovementComponent::RebindVehicle(Chaos::FSimpleWheeledVehicle& PVehicle)
+{
+	// SetupVehicle disables the mechanical simulation when there is no torque curve
+	const bool bCanSimulateMechanics = bMechanicalSimEnabled && !EngineSetup.TorqueCurve.GetRichCurve()->IsEmpty();
+	const int32 NumMechanicalSystems = bCanSimulateMechanics ? 1 : 0;
+
+	if (!Super::RebindVehicle(PVehicle) || PVehicle.Wheels.Num() != WheelSetups.Num()
+		|| PVehicle.Engine.Num() != NumMechanicalSystems || PVehicle.Transmission.Num() != NumMechanicalSystems || PVehicle.Differential.Num() != NumMechanicalSystems
+		|| PVehicle.Steering.Num() != 1 || PVehicle.TorqueControlSim.Num() != 1 || PVehicle.TargetRotationControlSim.Num() != 1 || PVehicle.StabilizeControlSim.Num() != 1)
+	{
+		return false;
+	}
+
+	bMechanicalSimEnabled = bCanSimulateMechanics;
+	NumDrivenWheels = PVehicle.NumDrivenWheels;
+	WheelTrackDimensions = CalculateWheelLayoutDimensions();
+
+	if (bMechanicalSimEnabled)
+	{
+		PVehicle.Engine[0].SetupPtr = &EngineSetup.GetPhysicsEngineConfig();
+		PVehicle.Transmission[0].SetupPtr = &TransmissionSetup.GetPhysicsTransmissionConfig();
+		PVehicle.Differential[0].SetupPtr = &DifferentialSetup.GetPhysicsDifferentialConfig();
+		TransmissionType = PVehicle.Transmission[0].Setup().TransmissionType;
+	}
+
+	PVehicle.Steering[0].SetupPtr = &SteeringSetup.GetPhysicsSteeringConfig(WheelTrackDimensions);
+	PVehicle.TorqueControlSim[0].SetupPtr = &TorqueControl.GetTorqueControlConfig();
+	PVehicle.TargetRotationControlSim[0].SetupPtr = &TargetRotationControl.GetTargetRotationControlConfig();
+	PVehicle.StabilizeControlSim[0].SetupPtr = &StabilizeControl.GetStabilizeControlConfig();
+
+	PVehicleOutput->Wheels.SetNum(PVehicle.Wheels.Num());
+
+	SetupVehicleShapes();
+	SetupVehicleMass();
+
+	return true;
+}
+
+bool UChaosWheeledVehicleMovementComponent::IsTuningChanged(uint32 SinceTag) const
+{
+	if (Super::IsTuningChanged(SinceTag))
+	{
+		return true;
+	}
+
+	for (const FChaosWheelSetup& WheelSetup : WheelSetups)
+	{
+		if (FChaosVehicleManager::HasTuningChanged(WheelSetup.WheelClass.Get(), SinceTag))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+TSharedPtr<FVehicleTuningPatch, ESPMode::ThreadSafe> UChaosWheeledVehicleMovementComponent::CreateTuningPatch()
+{
+	TSharedPtr<FWheeledVehicleTuningPatch, ESPMode::ThreadSafe> Patch = MakeShared<FWheeledVehicleTuningPatch, ESPMode::ThreadSafe>();
+	FillTuningPatch(*Patch);
+	return Patch;
+}
+
+void UChaosWheeledVehicleMovementComponent::FillTuningPatch(FVehicleTuningPatch& InPatch)
+{
+	using namespace Chaos;
+
+	Super::FillTuningPatch(InPatch);
+
+	FWheeledVehicleTuningPatch& Patch = static_cast<FWheeledVehicleTuningPatch&>(InPatch);
+
+	FVehicleEngineConfig EngineCopy = EngineSetup;
+	Patch.Engine = EngineCopy.GetPhysicsEngineConfig();
+
+	FVehicleTransmissionConfig TransmissionCopy = TransmissionSetup;
+	Patch.Transmission = TransmissionCopy.GetPhysicsTransmissionConfig();
+
+	FVehicleDifferentialConfig DifferentialCopy = DifferentialSetup;
+	Patch.Differential = DifferentialCopy.GetPhysicsDifferentialConfig();
+
+	WheelTrackDimensions = CalculateWheelLayoutDimensions();
+	FVehicleSteeringConfig SteeringCopy = SteeringSetup;
+	Patch.Steering = SteeringCopy.GetPhysicsSteeringConfig(WheelTrackDimensions);
+
+	Patch.bLegacyWheelFrictionPosition = bLegacyWheelFrictionPosition;
+
+	// wheels swapped or retuned at runtime keep their setups
+	if (bVehicleSetupModified)
+	{
+		return;
+	}
+
+	// build the wheel and suspension setups the same way SetupVehicle does, through sims pointing at the patch
+	Patch.Wheels.SetNum(WheelSetups.Num());
+	Patch.Suspension.SetNum(WheelSetups.Num());
+
+	TArray<FSimpleWheelSim> WheelSims;
+	TArray<FSimpleSuspensionSim> SuspensionSims;
+	WheelSims.Reserve(WheelSetups.Num());
+	SuspensionSims.Reserve(WheelSetups.Num());
+
+	for (int32 WheelIdx = 0; WheelIdx < WheelSetups.Num(); ++WheelIdx)
+	{
+		TSharedPtr<const FChaosVehicleWheelSharedConfig> SharedConfig = UChaosVehicleWheel::GetSharedConfig(WheelSetups[WheelIdx].WheelClass);
+		check(SharedConfig);
+
+		Patch.Wheels[WheelIdx] = SharedConfig->WheelConfig;
+		Patch.Suspension[WheelIdx] = SharedConfig->SuspensionConfig;
+
+		FSimpleWheelSim& WheelSim = WheelSims.Add_GetRef(FSimpleWheelSim(&Patch.Wheels[WheelIdx]));
+		SetupWheelEngineEnabled(WheelSim, WheelSetups[WheelIdx].WheelClass.GetDefaultObject());
+
+		if (WheelSim.Setup().EngineEnabled)
+		{
+			Patch.NumDrivenWheels++;
+		}
+
+		SuspensionSims.Add(FSimpleSuspensionSim(&Patch.Suspension[WheelIdx]));
+	}
+
+	if (bMechanicalSimEnabled)
+	{
+		FSimpleDifferentialSim DifferentialSim(&Patch.Differential);
+		SetupWheelTorqueRatios(WheelSims, DifferentialSim);
+	}
+
+	SetupSuspension(SuspensionSims);
+
+	Patch.SuspensionRestingPositions.Reset(SuspensionSims.Num());
+	for (const FSimpleSuspensionSim& SuspensionSim : SuspensionSims)
+	{
+		Patch.SuspensionRestingPositions.Add(SuspensionSim.GetLocalRestingPosition());
+	}
+
+	// same order the axles were added to the vehicle in
+	RecalculateAxles();
+	Patch.RollbarScaling.Reset(AxleToWheelMap.Num());
+	for (const auto& Axle : AxleToWheelMap)
+	{
+		Patch.RollbarScaling.Add(Axle.Key->RollbarScaling);
+	}
+
+	NumDrivenWheels = Patch.NumDrivenWheels;
+}
+
 void UChaosWheeledVehicleMovementComponent::ResetVehicleState()
 {
 	UChaosVehicleMovementComponent::ResetVehicleState();
@@ -1543,6 +2306,7 @@ void UChaosWheeledVehicleMovementComponent::ResetVehicleState()
 	for (FCachedState& State : CachedState)
 	{
 		State.bIsValid = false;
+		State.bTracePending = false;
 	}
 }
 
@@ -1557,7 +2321,17 @@ void UChaosWheeledVehicleMovementComponent::SetupVehicleShapes()
 
 void UChaosWheeledVehicleMovementComponent::SetupSuspension(TUniquePtr<Chaos::FSimpleWheeledVehicle>& PVehicle)
 {
-	if (!PVehicle.IsValid() || PVehicle->Suspension.Num() == 0)
+	if (!PVehicle.IsValid())
+	{
+		return;
+	}
+
+	SetupSuspension(PVehicle->Suspension);
+}
+
+void UChaosWheeledVehicleMovementComponent::SetupSuspension(TArray<Chaos::FSimpleSuspensionSim>& SuspensionSims)
+{
+	if (SuspensionSims.Num() == 0)
 	{
 		return;
 	}
@@ -1568,15 +2342,15 @@ void UChaosWheeledVehicleMovementComponent::SetupSuspension(TUniquePtr<Chaos::FS
 	TArray<FVector> LocalSpringPositions;
 
 	// cache vehicle local position of springs
-	for (int SpringIdx = 0; SpringIdx < PVehicle->Suspension.Num(); SpringIdx++)
+	for (int SpringIdx = 0; SpringIdx < SuspensionSims.Num(); SpringIdx++)
 	{
-		auto& PSuspension = PVehicle->Suspension[SpringIdx];
+		auto& PSuspension = SuspensionSims[SpringIdx];
 
 		PSuspension.AccessSetup().MaxLength = PSuspension.Setup().SuspensionMaxDrop + PSuspension.Setup().SuspensionMaxRaise;
 
 		FVector TotalOffset = GetWheelRestingPosition(WheelSetups[SpringIdx]);
 		LocalSpringPositions.Add(TotalOffset);
-		PVehicle->Suspension[SpringIdx].SetLocalRestingPosition(LocalSpringPositions[SpringIdx]);
+		SuspensionSims[SpringIdx].SetLocalRestingPosition(LocalSpringPositions[SpringIdx]);
 	}
 
 	// Calculate the mass that will rest on each of the springs
@@ -1591,16 +2365,16 @@ void UChaosWheeledVehicleMovementComponent::SetupSuspension(TUniquePtr<Chaos::FS
 	}
 
 	// Calculate spring damping values we will use for physics simulation from the normalized damping ratio
-	for (int SpringIdx = 0; SpringIdx < PVehicle->Suspension.Num(); SpringIdx++)
+	for (int SpringIdx = 0; SpringIdx < SuspensionSims.Num(); SpringIdx++)
 	{
-		auto& Susp = PVehicle->Suspension[SpringIdx];
+		auto& Susp = SuspensionSims[SpringIdx];
 		float NaturalFrequency = FSuspensionUtility::ComputeNaturalFrequency(Susp.Setup().SpringRate, OutSprungMasses[SpringIdx]);
 		float Damping = FSuspensionUtility::ComputeDamping(Susp.Setup().SpringRate, OutSprungMasses[SpringIdx], Susp.Setup().DampingRatio);
 		UE_LOG(LogChaos, Verbose, TEXT("Spring %d: OutNaturalFrequency %.1f Hz  (@1.0) DampingRate %.1f"), SpringIdx, NaturalFrequency / (2.0f * PI), Damping);
 
-		PVehicle->Suspension[SpringIdx].AccessSetup().ReboundDamping = Damping;
-		PVehicle->Suspension[SpringIdx].AccessSetup().CompressionDamping = Damping;
-		PVehicle->Suspension[SpringIdx].AccessSetup().RestingForce = OutSprungMasses[SpringIdx] * -GetGravityZ();
+		SuspensionSims[SpringIdx].AccessSetup().ReboundDamping = Damping;
+		SuspensionSims[SpringIdx].AccessSetup().CompressionDamping = Damping;
+		SuspensionSims[SpringIdx].AccessSetup().RestingForce = OutSprungMasses[SpringIdx] * -GetGravityZ();
 	}
 
 }
@@ -1700,28 +2474,52 @@ void UChaosWheeledVehicleMovementComponent::Update(float DeltaTime)
 			if (auto Handle = BodyInstance->ActorHandle)
 			{
 				FChaosVehicleAsyncInput* AsyncInput = static_cast<FChaosVehicleAsyncInput*>(CurAsyncInput);
+				AsyncInput->PhysicsInputs.TraceQueryParams = GetTraceQueryParams();
+			}
+		}
+	}
+}
 
-				TArray<AActor*> ActorsToIgnore;
-				ActorsToIgnore.Add(GetPawnOwner()); // ignore self in scene query
 
-				FCollisionQueryParams TraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), false, nullptr);
-				TraceParams.bReturnPhysicalMaterial = true;	// we need this to get the surface friction coefficient
-				TraceParams.AddIgnoredActors(ActorsToIgnore);
-				TraceParams.bTraceComplex = true;
-				AsyncInput->PhysicsInputs.TraceParams = TraceParams;
-				AsyncInput->PhysicsInputs.TraceCollisionResponse = WheelTraceCollisionResponses;
+const TSharedPtr<const FVehicleTraceQueryParams, ESPMode::ThreadSafe>& UChaosWheeledVehicleMovementComponent::GetTraceQueryParams()
+{
+	AActor* Owner = GetPawnOwner();
 
-				AsyncInput->PhysicsInputs.WheelTraceParams.SetNum(Wheels.Num());
-				for (int I = 0; I < Wheels.Num(); I++)
-				{
-					AsyncInput->PhysicsInputs.WheelTraceParams[I].SweepType = Wheels[I]->SweepType;
-					AsyncInput->PhysicsInputs.WheelTraceParams[I].SweepShape = Wheels[I]->SweepShape;
-				}
-			}
+	bool bUpToDate = TraceQueryParams.IsValid()
+		&& TraceQueryParamsOwner.Get() == Owner
+		&& FMemory::Memcmp(&TraceQueryParams->TraceCollisionResponse, &WheelTraceCollisionResponses, sizeof(FCollisionResponseContainer)) == 0
+		&& TraceQueryParams->WheelTraceParams.Num() == Wheels.Num();
+
+	for (int I = 0; bUpToDate && I < Wheels.Num(); I++)
+	{
+		const FWheelTraceParams& WheelTraceParams = TraceQueryParams->WheelTraceParams[I];
+		bUpToDate = (WheelTraceParams.SweepType == Wheels[I]->SweepType) && (WheelTraceParams.SweepShape == Wheels[I]->SweepShape);
+	}
+
+	if (!bUpToDate)
+	{
+		// the physics thread may still be reading the previous instance, so always build a new one
+		TSharedPtr<FVehicleTraceQueryParams, ESPMode::ThreadSafe> NewParams = MakeShared<FVehicleTraceQueryParams, ESPMode::ThreadSafe>();
+
+		NewParams->SimpleTraceParams.bReturnPhysicalMaterial = true;	// we need this to get the surface friction coefficient
+		NewParams->SimpleTraceParams.AddIgnoredActor(Owner); // ignore self in scene query
+		NewParams->ComplexTraceParams = NewParams->SimpleTraceParams;
+		NewParams->ComplexTraceParams.bTraceComplex = true;
+		NewParams->TraceCollisionResponse = WheelTraceCollisionResponses;
+
+		NewParams->WheelTraceParams.SetNum(Wheels.Num());
+		for (int I = 0; I < Wheels.Num(); I++)
+		{
+			NewParams->WheelTraceParams[I].SweepType = Wheels[I]->SweepType;
+			NewParams->WheelTraceParams[I].SweepShape = Wheels[I]->SweepShape;
 		}
+
+		TraceQueryParams = NewParams;
+		TraceQueryParamsOwner = Owner;
 	}
-}
 
+	return TraceQueryParams;
+}
 
 // Debug
 void UChaosWheeledVehicleMovementComponent::DrawDebug(UCanvas* Canvas, float& YL, float& YPos)
@@ -2169,45 +2967,58 @@ void UChaosWheeledVehicleMovementComponent::DrawDial(UCanvas* Canvas, FVector2D
 
 #endif
 
+static void FillWheelStatus(FWheelStatus& State, const FWheelsOutput& PWheel)
+{
+	State.bIsValid = true;
+	State.bInContact = PWheel.bBlockingHit;
+	State.ContactPoint = PWheel.ImpactPoint;
+	State.HitLocation = PWheel.HitLocation;
+	State.PhysMaterial = PWheel.PhysMaterial;
+	State.NormalizedSuspensionLength = PWheel.NormalizedSuspensionLength;
+	State.SpringForce = PWheel.SpringForce;
+	State.SlipAngle = PWheel.SlipAngle;
+	State.bIsSlipping = PWheel.bIsSlipping;
+	State.SlipMagnitude = PWheel.SlipMagnitude;
+	State.bIsSkidding = PWheel.bIsSkidding;
+	State.SkidMagnitude = PWheel.SkidMagnitude;
+	if (State.bIsSkidding)
+	{
+		State.SkidNormal = PWheel.SkidNormal;
+		//DrawDebugLine(GetWorld()
+		//	, State.ContactPoint
+		//	, State.ContactPoint + State.SkidNormal
+		//	, FColor::Yellow, true, -1.0f, 0, 4);
+	}
+	else
+	{
+		State.SkidNormal = FVector::ZeroVector;
+	}
+	State.DriveTorque = PWheel.DriveTorque;
+	State.BrakeTorque = PWheel.BrakeTorque;
+	State.bABSActivated = PWheel.bABSActivated;
+}
+
 void UChaosWheeledVehicleMovementComponent::FillWheelOutputState()
 {
 	if (const FChaosVehicleAsyncOutput* CurrentOutput = static_cast<FChaosVehicleAsyncOutput*>(CurAsyncOutput))
 	{
 		if (CurrentOutput->bValid && PVehicleOutput)
 		{
-			for (int WheelIdx = 0; WheelIdx < WheelStatus.Num(); WheelIdx++)
+			if (OutputView.IsValid())
 			{
-				auto& PWheel = PVehicleOutput->Wheels[WheelIdx];
-
-				FWheelStatus& State = WheelStatus[WheelIdx];
-
-				State.bIsValid = true;
-				State.bInContact = PWheel.bBlockingHit;
-				State.ContactPoint = PWheel.ImpactPoint;
-				State.HitLocation = PWheel.HitLocation;
-				State.PhysMaterial = PWheel.PhysMaterial;
-				State.NormalizedSuspensionLength = PWheel.NormalizedSuspensionLength;
-				State.SpringForce = PWheel.SpringForce;
-				State.SlipAngle = PWheel.SlipAngle;
-				State.bIsSlipping = PWheel.bIsSlipping;
-				State.SlipMagnitude = PWheel.SlipMagnitude;
-				State.bIsSkidding = PWheel.bIsSkidding;
-				State.SkidMagnitude = PWheel.SkidMagnitude;
-				if (State.bIsSkidding)
+				// the wheels were not copied into PVehicleOutput, so interpolate them through the view
+				FWheelsOutput PWheel;
+				for (int WheelIdx = 0; WheelIdx < WheelStatus.Num() && WheelIdx < OutputView.NumWheels(); WheelIdx++)
 				{
-					State.SkidNormal = PWheel.SkidNormal;
-					//DrawDebugLine(GetWorld()
-					//	, State.ContactPoint
-					//	, State.ContactPoint + State.SkidNormal
-					//	, FColor::Yellow, true, -1.0f, 0, 4);
+					OutputView.GetWheel(WheelIdx, PWheel);
+					FillWheelStatus(WheelStatus[WheelIdx], PWheel);
 				}
-				else
-				{
-					State.SkidNormal = FVector::ZeroVector;
-				}
-				State.DriveTorque = PWheel.DriveTorque;
-				State.BrakeTorque = PWheel.BrakeTorque;
-				State.bABSActivated = PWheel.bABSActivated;
+				return;
+			}
+
+			for (int WheelIdx = 0; WheelIdx < WheelStatus.Num(); WheelIdx++)
+			{
+				FillWheelStatus(WheelStatus[WheelIdx], PVehicleOutput->Wheels[WheelIdx]);
 			}
 		}
 	}
@@ -2314,34 +3125,22 @@ void UChaosWheeledVehicleMovementComponent::ParallelUpdate(float DeltaSeconds)
 
 void UChaosWheeledVehicleMovementComponent::SetWheelClass(int WheelIndex, TSubclassOf<UChaosVehicleWheel> InWheelClass)
 {
-	if (UpdatedPrimitive && InWheelClass)
+	if (UpdatedPrimitive && InWheelClass && VehicleSimulationPT && Wheels.IsValidIndex(WheelIndex))
 	{
-		FBodyInstance* TargetInstance = GetBodyInstance();
-
-		if (TargetInstance && WheelIndex < Wheels.Num())
-		{
-
-			FPhysicsCommand::ExecuteWrite(TargetInstance->ActorHandle, [&](const FPhysicsActorHandle& Chassis)
-				{
-					if (VehicleSimulationPT)
-					{
-						UChaosVehicleWheel* OldWheel = Wheels[WheelIndex];
-						UChaosVehicleWheel* NewWheel = NewObject<UChaosVehicleWheel>(this, InWheelClass);
-						NewWheel->Init(this, WheelIndex);
+		UChaosVehicleWheel* OldWheel = Wheels[WheelIndex];
+		UChaosVehicleWheel* NewWheel = NewObject<UChaosVehicleWheel>(this, InWheelClass);
+		NewWheel->Init(this, WheelIndex);
 
-						VehicleSimulationPT->InitializeWheel(WheelIndex, &NewWheel->GetPhysicsWheelConfig());
-						VehicleSimulationPT->InitializeSuspension(WheelIndex, &NewWheel->GetPhysicsSuspensionConfig());
+		// the physics thread may be stepping the vehicle, so the new setup is copied into its wheel by the next async input
+		FVehicleWheelClassChange& WheelClassChange = PendingWheelClassChanges.AddDefaulted_GetRef();
+		WheelClassChange.WheelIndex = WheelIndex;
+		WheelClassChange.SharedConfig = UChaosVehicleWheel::GetSharedConfig(InWheelClass);
+		bVehicleSetupModified = true;
 
-						Wheels[WheelIndex] = NewWheel;
+		Wheels[WheelIndex] = NewWheel;
 
-						OldWheel->Shutdown();
-					}
-				});			
-				
-
-		}
+		OldWheel->Shutdown();
 	}
-
 }
 
 FWheeledSnaphotData UChaosWheeledVehicleMovementComponent::GetSnapshot() const
@@ -2727,6 +3526,7 @@ void UChaosWheeledVehicleMovementComponent::SetSuspensionParams(float Rate, floa
 					VehicleSuspension.AccessSetup().SpringPreload = Preload;
 					VehicleSuspension.AccessSetup().SetSuspensionMaxRaise(MaxRaise);
 					VehicleSuspension.AccessSetup().SetSuspensionMaxDrop(MaxDrop);
+					bVehicleSetupModified = true;
 				}
 			});
 
@@ -2762,20 +3562,6 @@ float UChaosWheeledVehicleMovementComponent::GetSuspensionOffset(int WheelIndex)
 {
 	float Offset = 0.f;
 
-	auto CalcOffset = [this](ESweepShape& SweepShape, FVector& LocalHitPoint, FVector& LocalPos, float Radius)
-	{
-		float NewOffset = 0.0f;
-		if (SweepShape == ESweepShape::Spherecast)
-		{
-			NewOffset = LocalHitPoint.Z - LocalPos.Z;
-		}
-		else
-		{
-			NewOffset = LocalHitPoint.Z - LocalPos.Z + Radius;
-		}
-		return NewOffset;
-	};
-
 	FChaosWheelSetup& WheelSetup = WheelSetups[WheelIndex];
 	if (GetBodyInstance())
 	{
@@ -2790,13 +3576,13 @@ float UChaosWheeledVehicleMovementComponent::GetSuspensionOffset(int WheelIndex)
 
 					FVector ReferencePos = (Wheel->SweepShape == ESweepShape::Spherecast)? WheelStatus[WheelIndex].HitLocation : WheelStatus[WheelIndex].ContactPoint;
 					FVector LocalHitPoint = VehicleWorldTransform.InverseTransformPosition(ReferencePos);
-					float Radius = PVehicleOutput->Wheels[WheelIndex].WheelRadius;
+					float Radius = GetOutputView().GetWheelRadius(WheelIndex);
 
 					if (CachedState[WheelIndex].bIsValid)
 					{
 						Offset = CachedState[WheelIndex].WheelOffset;
 
-						float NewOffset = CalcOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Radius);
+						float NewOffset = CalcSuspensionOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Radius);
 							
 						// interpolate between old and new positions or will just jump to new position if Wheel->SuspensionSmoothing == 0
 						float InterpolationMultiplier = 1.0f - (Wheel->SuspensionSmoothing / 11.0f);
@@ -2805,7 +3591,7 @@ float UChaosWheeledVehicleMovementComponent::GetSuspensionOffset(int WheelIndex)
 					}
 					else
 					{
-						Offset = CalcOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Radius);
+						Offset = CalcSuspensionOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Radius);
 					}
 					Offset = FMath::Clamp(Offset, -Wheel->SuspensionMaxDrop, Wheel->SuspensionMaxRaise);
 				}
@@ -2826,72 +3612,67 @@ float UChaosWheeledVehicleMovementComponent::GetSuspensionOffset(int WheelIndex)
 				}
 				else
 				{
-					ECollisionChannel SpringCollisionChannel = ECollisionChannel::ECC_WorldDynamic;
-					FCollisionResponseParams ResponseParams;
-					ResponseParams.CollisionResponse = WheelTraceCollisionResponses;
-
-					TArray<AActor*> ActorsToIgnore;
-					ActorsToIgnore.Add(GetPawnOwner()); // ignore self in scene query
-
-					FCollisionQueryParams TraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), false, nullptr);
-					TraceParams.bReturnPhysicalMaterial = true;	// we need this to get the surface friction coefficient
-					TraceParams.AddIgnoredActors(ActorsToIgnore);
-					TraceParams.bTraceComplex = (Wheels[WheelIndex]->SweepType == ESweepType::ComplexSweep);
-
 					FVector LocalDirection = Wheel->SuspensionAxis;
 					FVector WorldLocation = VehicleWorldTransform.TransformPosition(GetWheelRestingPosition(WheelSetup));
 					FVector WorldDirection = VehicleWorldTransform.TransformVector(LocalDirection);
 
 					FVector TraceStart = WorldLocation - WorldDirection * (Wheel->SuspensionMaxRaise);
 					FVector TraceEnd = WorldLocation + WorldDirection * (Wheel->SuspensionMaxDrop + Wheel->WheelRadius);
+					const bool bTraceComplex = (Wheels[WheelIndex]->SweepType == ESweepType::ComplexSweep);
 
-					FHitResult HitResult;
-					switch (Wheel->SweepShape)
+					FChaosVehicleManager* VehicleManager = GetWorld() ? FChaosVehicleManager::GetVehicleManagerFromScene(GetWorld()->GetPhysicsScene()) : nullptr;
+					if (GWheeledVehicleDebugParams.EnableAsyncSuspensionOffsetTraces && VehicleManager && VehicleHandle.IsValid())
 					{
-						case ESweepShape::Spherecast:
+						// serve the last known offset, or the resting position, until the batched trace lands
+						if (!CachedState[WheelIndex].bTracePending)
 						{
-							float WheelRadius = Wheel->WheelRadius;
-
-							GetWorld()->SweepSingleByChannel(HitResult
-								, TraceStart
-								, TraceEnd
-								, FQuat::Identity, SpringCollisionChannel
-								, FCollisionShape::MakeSphere(WheelRadius), TraceParams
-								, ResponseParams);
+							const float SweepRadius = (Wheel->SweepShape == ESweepShape::Spherecast) ? Wheel->WheelRadius : 0.f;
+							VehicleManager->RequestSuspensionTrace(VehicleHandle, WheelIndex, TraceStart, TraceEnd, SweepRadius, bTraceComplex, WheelTraceCollisionResponses, VehicleWorldTransform);
+							CachedState[WheelIndex].bTracePending = true;
 						}
-						break;
 
-						case ESweepShape::Raycast:
-						default:
-						{
-							GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, SpringCollisionChannel, TraceParams, ResponseParams);
-						}
-						break;
+						Offset = CachedState[WheelIndex].bIsValid ? CachedState[WheelIndex].WheelOffset : 0.f;
 					}
-
-					if (HitResult.bBlockingHit)
+					else
 					{
-						FVector LocalPos = GetWheelRestingPosition(WheelSetup);
-						if (Wheel->SweepShape == ESweepShape::Spherecast)
-						{
-							FVector LocalHitPoint = VehicleWorldTransform.InverseTransformPosition(HitResult.Location);
-							Offset = CalcOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Wheel->WheelRadius);
-						}
-						else
+						ECollisionChannel SpringCollisionChannel = ECollisionChannel::ECC_WorldDynamic;
+						FCollisionResponseParams ResponseParams;
+						ResponseParams.CollisionResponse = WheelTraceCollisionResponses;
+
+						FCollisionQueryParams TraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), false, nullptr);
+						TraceParams.bReturnPhysicalMaterial = true;	// we need this to get the surface friction coefficient
+						TraceParams.AddIgnoredActor(GetPawnOwner()); // ignore self in scene query
+						TraceParams.bTraceComplex = bTraceComplex;
+
+						FHitResult HitResult;
+						switch (Wheel->SweepShape)
 						{
-							FVector LocalHitPoint = VehicleWorldTransform.InverseTransformPosition(HitResult.ImpactPoint);
-							Offset = CalcOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Wheel->WheelRadius);
+							case ESweepShape::Spherecast:
+							{
+								float WheelRadius = Wheel->WheelRadius;
+
+								GetWorld()->SweepSingleByChannel(HitResult
+									, TraceStart
+									, TraceEnd
+									, FQuat::Identity, SpringCollisionChannel
+									, FCollisionShape::MakeSphere(WheelRadius), TraceParams
+									, ResponseParams);
+							}
+							break;
+
+							case ESweepShape::Raycast:
+							default:
+							{
+								GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, SpringCollisionChannel, TraceParams, ResponseParams);
+							}
+							break;
 						}
 
-						Offset = FMath::Clamp(Offset, -Wheel->SuspensionMaxDrop, Wheel->SuspensionMaxRaise);
-					}
-					else
-					{
-						Offset = -Wheel->SuspensionMaxDrop;
-					}
+						Offset = GetTracedSuspensionOffset(Wheel, WheelSetup, VehicleWorldTransform, HitResult);
 
-					CachedState[WheelIndex].bIsValid = true;
-					CachedState[WheelIndex].WheelOffset = Offset;
+						CachedState[WheelIndex].bIsValid = true;
+						CachedState[WheelIndex].WheelOffset = Offset;
+					}
 				}
 			}
 		}
@@ -2899,6 +3680,58 @@ float UChaosWheeledVehicleMovementComponent::GetSuspensionOffset(int WheelIndex)
 	return Offset;
 }
 
+float UChaosWheeledVehicleMovementComponent::GetTracedSuspensionOffset(const UChaosVehicleWheel* Wheel, const FChaosWheelSetup& WheelSetup, const FTransform& VehicleWorldTransform, const FHitResult& HitResult)
+{
+	float Offset = 0.f;
+
+	if (HitResult.bBlockingHit)
+	{
+		FVector LocalPos = GetWheelRestingPosition(WheelSetup);
+		FVector ReferencePos = (Wheel->SweepShape == ESweepShape::Spherecast) ? HitResult.Location : HitResult.ImpactPoint;
+		FVector LocalHitPoint = VehicleWorldTransform.InverseTransformPosition(ReferencePos);
+		Offset = CalcSuspensionOffset(Wheel->SweepShape, LocalHitPoint, LocalPos, Wheel->WheelRadius);
+
+		Offset = FMath::Clamp(Offset, -Wheel->SuspensionMaxDrop, Wheel->SuspensionMaxRaise);
+	}
+	else
+	{
+		Offset = -Wheel->SuspensionMaxDrop;
+	}
+
+	return Offset;
+}
+
+float UChaosWheeledVehicleMovementComponent::CalcSuspensionOffset(ESweepShape SweepShape, const FVector& LocalHitPoint, const FVector& LocalPos, float Radius)
+{
+	if (SweepShape == ESweepShape::Spherecast)
+	{
+		return LocalHitPoint.Z - LocalPos.Z;
+	}
+
+	return LocalHitPoint.Z - LocalPos.Z + Radius;
+}
+
+void UChaosWheeledVehicleMovementComponent::SetSuspensionTraceResult(int32 WheelIndex, const FHitResult* HitResult, const FTransform& VehicleWorldTransform)
+{
+	if (!CachedState.IsValidIndex(WheelIndex))
+	{
+		return;
+	}
+
+	FCachedState& State = CachedState[WheelIndex];
+	State.bTracePending = false;
+
+	// a dropped trace is requested again the next time the offset is needed
+	if (HitResult && WheelSetups.IsValidIndex(WheelIndex))
+	{
+		if (const UChaosVehicleWheel* Wheel = WheelSetups[WheelIndex].WheelClass.GetDefaultObject())
+		{
+			State.WheelOffset = GetTracedSuspensionOffset(Wheel, WheelSetups[WheelIndex], VehicleWorldTransform, *HitResult);
+			State.bIsValid = true;
+		}
+	}
+}
+
 
 UPhysicalMaterial* UChaosWheeledVehicleMovementComponent::GetPhysMaterial(int WheelIndex)
 {
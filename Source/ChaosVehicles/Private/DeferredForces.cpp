@@ -85,3 +85,36 @@ void FDeferredForces::AddImpulseAtPosition(Chaos::FRigidBodyHandle_Internal* Rig
 		RigidHandle->SetAngularImpulse(RigidHandle->AngularImpulse() + AngularImpulse, false);
 	}
 }
+
+void FDeferredForces::ApplyNetForces(Chaos::FRigidBodyHandle_Internal* RigidHandle)
+{
+	if (ensure(RigidHandle))
+	{
+		// the moments were summed about MomentOrigin, moving them to the centre of mass once covers every positional force
+		const Chaos::FVec3 WorldCOM = Chaos::FParticleUtilitiesGT::GetCoMWorldPosition(RigidHandle);
+		const Chaos::FVec3 OriginToCOM = WorldCOM - Net.MomentOrigin;
+
+		if (Net.bHasForce)
+		{
+			Chaos::EObjectStateType ObjectState = RigidHandle->ObjectState();
+			if (CHAOS_ENSURE(ObjectState == Chaos::EObjectStateType::Dynamic || ObjectState == Chaos::EObjectStateType::Sleeping))
+			{
+				Chaos::FVec3 Torque = Net.Torque + Net.Moment - Chaos::FVec3::CrossProduct(OriginToCOM, Net.PositionalForce);
+				if (!Net.AngularAcceleration.IsZero())
+				{
+					Torque += Chaos::FParticleUtilitiesXR::GetWorldInertia(RigidHandle) * Net.AngularAcceleration;
+				}
+
+				RigidHandle->AddForce(Net.Force + Net.Acceleration * RigidHandle->M(), false);
+				RigidHandle->AddTorque(Torque, false);
+			}
+		}
+
+		if (Net.bHasImpulse)
+		{
+			const Chaos::FVec3 AngularImpulse = Net.AngularImpulse - Chaos::FVec3::CrossProduct(OriginToCOM, Net.PositionalImpulse);
+			RigidHandle->SetLinearImpulse(RigidHandle->LinearImpulse() + Net.LinearImpulse + RigidHandle->M() * Net.VelocityChange, false);
+			RigidHandle->SetAngularImpulse(RigidHandle->AngularImpulse() + AngularImpulse, false);
+		}
+	}
+}
@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "HeightfieldContactProvider.h"
+#include "LandscapeHeightfieldCollisionComponent.h"
+#include "LandscapeDataAccess.h"
+#include "Chaos/HeightField.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+namespace HeightfieldContactProvider
+{
+	// a couple of refinements are enough for suspension length traces which are short compared to the height samples spacing
+	const int32 MaxIterations = 3;
+
+	struct FSurfaceSample
+	{
+		FVector Location;
+		FVector Normal;
+		int32 MaterialIndex;
+	};
+
+	/** Sample the surface vertically below/above WorldLocation in the heightfield's frame, false if outside or over a hole */
+	bool SampleSurface(const ULandscapeHeightfieldCollisionComponent* Component, const Chaos::FHeightField& Heightfield, const FVector& WorldLocation, FSurfaceSample& OutSample)
+	{
+		const FTransform& ComponentTransform = Component->GetComponentTransform();
+		const FVector Scale = ComponentTransform.GetScale3D() * FVector(Component->CollisionScale, Component->CollisionScale, LANDSCAPE_ZSCALE);
+		if (Scale.X <= 0.0f || Scale.Y <= 0.0f || Scale.Z <= 0.0f)
+		{
+			return false;
+		}
+
+		const FVector LocalLocation = ComponentTransform.InverseTransformPositionNoScale(WorldLocation);
+		const float GridX = LocalLocation.X / Scale.X;
+		const float GridY = LocalLocation.Y / Scale.Y;
+
+		const int32 CellX = FMath::FloorToInt(GridX);
+		const int32 CellY = FMath::FloorToInt(GridY);
+		if (CellX < 0 || CellY < 0 || CellX >= Heightfield.GetNumCols() - 1 || CellY >= Heightfield.GetNumRows() - 1)
+		{
+			return false;
+		}
+
+		if (Heightfield.IsHole(CellX, CellY))
+		{
+			return false;
+		}
+
+		const float FracX = GridX - CellX;
+		const float FracY = GridY - CellY;
+
+		const float H00 = Heightfield.GetHeight(CellX, CellY);
+		const float H10 = Heightfield.GetHeight(CellX + 1, CellY);
+		const float H01 = Heightfield.GetHeight(CellX, CellY + 1);
+		const float H11 = Heightfield.GetHeight(CellX + 1, CellY + 1);
+
+		const float Height = FMath::BiLerp(H00, H10, H01, H11, FracX, FracY);
+		const float SlopeX = FMath::Lerp(H10 - H00, H11 - H01, FracY);
+		const float SlopeY = FMath::Lerp(H01 - H00, H11 - H10, FracX);
+
+		const FVector LocalSurface(LocalLocation.X, LocalLocation.Y, Height * Scale.Z);
+		const FVector LocalNormal = FVector(-SlopeX * Scale.Z / Scale.X, -SlopeY * Scale.Z / Scale.Y, 1.0f).GetSafeNormal();
+
+		OutSample.Location = ComponentTransform.TransformPositionNoScale(LocalSurface);
+		OutSample.Normal = ComponentTransform.TransformVectorNoScale(LocalNormal);
+		OutSample.MaterialIndex = Heightfield.GetMaterialIndex(CellX, CellY);
+		return true;
+	}
+}
+
+bool FHeightfieldContactProvider::IsHeightfield(const UPrimitiveComponent* Component)
+{
+	const ULandscapeHeightfieldCollisionComponent* HeightfieldComponent = Cast<ULandscapeHeightfieldCollisionComponent>(Component);
+	return HeightfieldComponent && HeightfieldComponent->HeightfieldRef.IsValid() && HeightfieldComponent->HeightfieldRef->Heightfield.Get() != nullptr;
+}
+
+bool FHeightfieldContactProvider::Trace(UPrimitiveComponent* Component, const FVector& Start, const FVector& End, float SweepRadius, FHitResult& OutHit)
+{
+	using namespace HeightfieldContactProvider;
+
+	if (!IsHeightfield(Component))
+	{
+		return false;
+	}
+
+	const ULandscapeHeightfieldCollisionComponent* HeightfieldComponent = CastChecked<ULandscapeHeightfieldCollisionComponent>(Component);
+	const Chaos::FHeightField& Heightfield = *HeightfieldComponent->HeightfieldRef->Heightfield;
+
+	const FVector TraceNormal = (Start - End).GetSafeNormal(); // reversed
+	const FVector SweepStart = Start + TraceNormal * SweepRadius;
+	const FVector Delta = End - SweepStart;
+
+	// treat the surface as the tangent plane under the current estimate and walk the estimate onto it
+	FSurfaceSample Sample;
+	FVector Location = SweepStart;
+	float Time = 0.0f;
+	for (int32 Iteration = 0; Iteration < MaxIterations; Iteration++)
+	{
+		if (!SampleSurface(HeightfieldComponent, Heightfield, Location, Sample))
+		{
+			return false;
+		}
+
+		const float Approach = FVector::DotProduct(Delta, Sample.Normal);
+		if (Approach > -KINDA_SMALL_NUMBER)
+		{
+			// parallel to or leaving the surface
+			return false;
+		}
+
+		Time = (SweepRadius - FVector::DotProduct(SweepStart - Sample.Location, Sample.Normal)) / Approach;
+		Location = SweepStart + Delta * FMath::Clamp(Time, 0.0f, 1.0f);
+	}
+
+	if (Time < 0.0f)
+	{
+		// already penetrating at the start, leave that to the generic query to report
+		return false;
+	}
+
+	OutHit = FHitResult();
+	if (Time > 1.0f)
+	{
+		return true;
+	}
+
+	OutHit.bBlockingHit = true;
+	OutHit.Time = Time;
+	OutHit.Distance = Delta.Size() * Time;
+	OutHit.Location = Location;
+	OutHit.ImpactPoint = Location - Sample.Normal * SweepRadius;
+	OutHit.Normal = Sample.Normal;
+	OutHit.ImpactNormal = Sample.Normal;
+	OutHit.TraceStart = SweepStart;
+	OutHit.TraceEnd = End;
+	OutHit.Component = Component;
+	OutHit.HitObjectHandle = FActorInstanceHandle(Component->GetOwner());
+
+	if (HeightfieldComponent->CookedPhysicalMaterials.IsValidIndex(Sample.MaterialIndex))
+	{
+		OutHit.PhysMaterial = HeightfieldComponent->CookedPhysicalMaterials[Sample.MaterialIndex];
+	}
+
+	return true;
+}
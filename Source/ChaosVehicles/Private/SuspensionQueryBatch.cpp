@@ -0,0 +1,191 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SuspensionQueryBatch.h"
+#include "ChaosVehicleManagerAsyncCallback.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+#include "HeightfieldContactProvider.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+#include "Chaos/Framework/Parallel.h"
+
+extern FWheeledVehicleDebugParams GWheeledVehicleDebugParams;
+
+DECLARE_CYCLE_STAT(TEXT("SuspensionQueryBatch:Resolve"), STAT_SuspensionQueryBatch_Resolve, STATGROUP_ChaosVehicleManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumBatchedSuspensionQueries"), STAT_NumBatchedSuspensionQueries, STATGROUP_ChaosVehicleManager);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NumSuspensionQueryCells"), STAT_NumSuspensionQueryCells, STATGROUP_ChaosVehicleManager);
+
+namespace SuspensionQueryBatch
+{
+	/** Spread the low 21 bits of Value so there are two zero bits between each one */
+	uint64 SpreadBits(uint64 Value)
+	{
+		Value &= 0x1fffff;
+		Value = (Value | Value << 32) & 0x1f00000000ffff;
+		Value = (Value | Value << 16) & 0x1f0000ff0000ff;
+		Value = (Value | Value << 8) & 0x100f00f00f00f00f;
+		Value = (Value | Value << 4) & 0x10c30c30c30c30c3;
+		Value = (Value | Value << 2) & 0x1249249249249249;
+		return Value;
+	}
+
+	/** Morton order key of a cell so that neighbouring cells also end up close together once sorted */
+	uint64 CellKey(const FVector& Location, float InvCellSize)
+	{
+		const int32 Bias = 1 << 20;
+		const uint64 X = (uint64)(FMath::FloorToInt(Location.X * InvCellSize) + Bias);
+		const uint64 Y = (uint64)(FMath::FloorToInt(Location.Y * InvCellSize) + Bias);
+		const uint64 Z = (uint64)(FMath::FloorToInt(Location.Z * InvCellSize) + Bias);
+		return SpreadBits(X) | (SpreadBits(Y) << 1) | (SpreadBits(Z) << 2);
+	}
+}
+
+void FSuspensionQueryBatch::AddQuery(const FVector& Start, const FVector& End, float SweepRadius, bool bTraceComplex
+	, const FCollisionQueryParams& TraceParams, const FCollisionResponseContainer& CollisionResponse, FHitResult& Result)
+{
+	FQuery& Query = Queries.AddDefaulted_GetRef();
+	Query.Start = Start;
+	Query.End = End;
+	Query.SweepRadius = SweepRadius;
+	Query.bTraceComplex = bTraceComplex;
+	Query.ResponseHash = FCrc::MemCrc32(&CollisionResponse, sizeof(FCollisionResponseContainer));
+	Query.CellKey = 0;
+	Query.TraceParams = &TraceParams;
+	Query.CollisionResponse = &CollisionResponse;
+	Query.Result = &Result;
+}
+
+void FSuspensionQueryBatch::Resolve(UWorld* World, float CellSize, bool bForceSingleThread)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SuspensionQueryBatch_Resolve);
+
+	Cells.Reset();
+
+	if (World == nullptr || Queries.Num() == 0)
+	{
+		return;
+	}
+
+	// suspension traces are short compared to a cell so the midpoint is enough to place them
+	const float InvCellSize = 1.0f / FMath::Max(CellSize, 1.0f);
+	for (FQuery& Query : Queries)
+	{
+		Query.CellKey = SuspensionQueryBatch::CellKey((Query.Start + Query.End) * 0.5f, InvCellSize);
+	}
+
+	// queries can only share an overlap if they share a collision response too
+	Queries.Sort([](const FQuery& A, const FQuery& B)
+		{
+			return (A.CellKey < B.CellKey) || (A.CellKey == B.CellKey && A.ResponseHash < B.ResponseHash);
+		});
+
+	for (int32 QueryIdx = 0; QueryIdx < Queries.Num(); QueryIdx++)
+	{
+		const FQuery& Query = Queries[QueryIdx];
+		if (Cells.Num() > 0)
+		{
+			FCell& LastCell = Cells.Last();
+			const FQuery& CellQuery = Queries[LastCell.FirstQuery];
+			if (CellQuery.CellKey == Query.CellKey && CellQuery.ResponseHash == Query.ResponseHash)
+			{
+				LastCell.NumQueries++;
+				continue;
+			}
+		}
+
+		FCell& Cell = Cells.AddDefaulted_GetRef();
+		Cell.FirstQuery = QueryIdx;
+		Cell.NumQueries = 1;
+	}
+
+	SET_DWORD_STAT(STAT_NumBatchedSuspensionQueries, Queries.Num());
+	SET_DWORD_STAT(STAT_NumSuspensionQueryCells, Cells.Num());
+
+	// only ever grows, shrinking would free the overlap arrays the next step reuses
+	if (CellOverlapResults.Num() < Cells.Num())
+	{
+		CellOverlapResults.SetNum(Cells.Num());
+	}
+
+	PhysicsParallelFor(Cells.Num(), [this, World](int32 CellIdx)
+		{
+			ResolveCell(World, Cells[CellIdx], CellOverlapResults[CellIdx]);
+		}, bForceSingleThread);
+}
+
+void FSuspensionQueryBatch::ResolveCell(UWorld* World, const FCell& Cell, TArray<FOverlapResult>& OverlapResults)
+{
+	const FQuery& FirstQuery = Queries[Cell.FirstQuery];
+
+	FBox QueryBox(ForceInit);
+	for (int32 QueryIdx = Cell.FirstQuery; QueryIdx < Cell.FirstQuery + Cell.NumQueries; QueryIdx++)
+	{
+		const FQuery& Query = Queries[QueryIdx];
+		const FVector Radius(Query.SweepRadius);
+		QueryBox += FBox(Query.Start - Radius, Query.Start + Radius);
+		QueryBox += FBox(Query.End - Radius, Query.End + Radius);
+	}
+
+	FCollisionShape CollisionBox;
+	CollisionBox.SetBox((FVector3f)QueryBox.GetExtent());
+
+	// the overlap is shared between vehicles so it cannot carry any one vehicle's ignore list, that is applied per query below
+	FCollisionQueryParams CellParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), false, nullptr);
+	CellParams.bReturnPhysicalMaterial = true;
+
+	FCollisionResponseParams ResponseParams;
+	ResponseParams.CollisionResponse = *FirstQuery.CollisionResponse;
+
+	OverlapResults.Reset();
+	const bool bOverlapHit = World->OverlapMultiByChannel(OverlapResults, QueryBox.GetCenter(), FQuat::Identity, ECollisionChannel::ECC_WorldDynamic, CollisionBox, CellParams, ResponseParams);
+
+	for (int32 QueryIdx = Cell.FirstQuery; QueryIdx < Cell.FirstQuery + Cell.NumQueries; QueryIdx++)
+	{
+		const FQuery& Query = Queries[QueryIdx];
+		FHitResult& HitResult = *Query.Result;
+		HitResult = FHitResult();
+
+		if (!bOverlapHit)
+		{
+			continue;
+		}
+
+		CellParams.bTraceComplex = Query.bTraceComplex;
+		const FVector TraceNormal = (Query.Start - Query.End).GetSafeNormal(); // reversed
+
+		for (const FOverlapResult& OverlapResult : OverlapResults)
+		{
+			if (!OverlapResult.bBlockingHit)
+				continue;
+
+			UPrimitiveComponent* Component = OverlapResult.Component.Get();
+			if (Component == nullptr)
+				continue;
+
+			const AActor* Actor = OverlapResult.GetActor();
+			if (Actor && Query.TraceParams->GetIgnoredActors().Contains(Actor->GetUniqueID()))
+				continue;
+
+			FHitResult ComponentHit;
+			bool bHit = false;
+			if (GWheeledVehicleDebugParams.EnableHeightfieldContacts && FHeightfieldContactProvider::Trace(Component, Query.Start, Query.End, Query.SweepRadius, ComponentHit))
+			{
+				bHit = ComponentHit.bBlockingHit;
+			}
+			else if (Query.SweepRadius > 0.0f)
+			{
+				const FVector Start = Query.Start + TraceNormal * Query.SweepRadius;
+				bHit = Component->SweepComponent(ComponentHit, Start, Query.End, FQuat::Identity, FCollisionShape::MakeSphere(Query.SweepRadius), Query.bTraceComplex);
+			}
+			else
+			{
+				bHit = Component->LineTraceComponent(ComponentHit, Query.Start, Query.End, CellParams);
+			}
+
+			if (bHit && ComponentHit.Time < HitResult.Time)
+			{
+				HitResult = ComponentHit;
+				HitResult.bBlockingHit = true;
+			}
+		}
+	}
+}
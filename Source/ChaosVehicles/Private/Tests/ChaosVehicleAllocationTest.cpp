@@ -0,0 +1,200 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/MemoryBase.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Components/StaticMeshComponent.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+#include "ChaosVehicleManagerAsyncCallback.h"
+#include "ChaosVehicleWheel.h"
+
+namespace ChaosVehicleAllocationTest
+{
+	/** Depth of the vehicle simulations the current thread is inside */
+	thread_local int32 GSimulateDepth = 0;
+
+	/**
+	 * Forwards to the allocator it wraps, counting the allocations made from inside a vehicle simulation.
+	 * It is created once and never freed, so threads that read GMalloc while it is swapped always reach a live allocator
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		static FCountingMalloc& Get()
+		{
+			static FCountingMalloc* Instance = new FCountingMalloc(GMalloc);
+			return *Instance;
+		}
+
+		void Install()
+		{
+			NumAllocations = 0;
+			FPlatformAtomics::InterlockedExchangePtr((void**)&GMalloc, this);
+		}
+
+		void Uninstall()
+		{
+			FPlatformAtomics::InterlockedExchangePtr((void**)&GMalloc, Inner);
+		}
+
+		int32 GetNumAllocations() const { return NumAllocations.load(); }
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				CountAllocation();
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	private:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+			, NumAllocations(0)
+		{
+		}
+
+		void CountAllocation()
+		{
+			if (GSimulateDepth > 0)
+			{
+				NumAllocations++;
+			}
+		}
+
+		FMalloc* Inner;
+		std::atomic<int32> NumAllocations;
+	};
+
+	/** Marks the threads running a vehicle simulation so only their allocations are counted */
+	class FSimulationObserver final : public IChaosVehicleSimulationObserver
+	{
+	public:
+		virtual void OnBeginSimulate() override
+		{
+			GSimulateDepth++;
+			NumSimulations++;
+		}
+
+		virtual void OnEndSimulate() override
+		{
+			GSimulateDepth--;
+		}
+
+		std::atomic<int32> NumSimulations = 0;
+	};
+
+	AStaticMeshActor* SpawnBox(UWorld* World, UStaticMesh* Mesh, const FVector& Location, const FVector& Scale, bool bSimulatePhysics)
+	{
+		AStaticMeshActor* Actor = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator);
+		UStaticMeshComponent* MeshComponent = Actor->GetStaticMeshComponent();
+		MeshComponent->SetMobility(EComponentMobility::Movable);
+		MeshComponent->SetStaticMesh(Mesh);
+		Actor->SetActorScale3D(Scale);
+		MeshComponent->SetSimulatePhysics(bSimulatePhysics);
+		return Actor;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChaosVehicleTickAllocationTest, "Physics.ChaosVehicles.TickVehicleDoesNotAllocate", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FChaosVehicleTickAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace ChaosVehicleAllocationTest;
+
+	const float DeltaTime = 1.0f / 60.0f;
+	const int32 NumWarmupTicks = 30;
+	const int32 NumCountedTicks = 60;
+
+	UStaticMesh* BoxMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Box mesh"), BoxMesh))
+	{
+		return false;
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// the suspension needs something to trace against
+	SpawnBox(World, BoxMesh, FVector(0.0f, 0.0f, -50.0f), FVector(100.0f, 100.0f, 1.0f), false);
+	AStaticMeshActor* Chassis = SpawnBox(World, BoxMesh, FVector(0.0f, 0.0f, 100.0f), FVector(4.0f, 2.0f, 1.0f), true);
+
+	UChaosWheeledVehicleMovementComponent* Movement = NewObject<UChaosWheeledVehicleMovementComponent>(Chassis);
+	const FVector WheelOffsets[] = { FVector(150.0f, -90.0f, -50.0f), FVector(150.0f, 90.0f, -50.0f), FVector(-150.0f, -90.0f, -50.0f), FVector(-150.0f, 90.0f, -50.0f) };
+	for (int32 WheelIdx = 0; WheelIdx < UE_ARRAY_COUNT(WheelOffsets); WheelIdx++)
+	{
+		FChaosWheelSetup& WheelSetup = Movement->WheelSetups.AddDefaulted_GetRef();
+		WheelSetup.WheelClass = UChaosVehicleWheel::StaticClass();
+		WheelSetup.BoneName = FName(TEXT("Wheel"), WheelIdx + 1);
+		WheelSetup.AdditionalOffset = WheelOffsets[WheelIdx];
+	}
+	Movement->SetUpdatedComponent(Chassis->GetStaticMeshComponent());
+	Movement->RegisterComponent();
+
+	Chaos::FPhysicsSolver* Solver = World->GetPhysicsScene()->GetSolver();
+
+	// the vehicle is stepped by the physics solver through the vehicle manager, the same way it is in game
+	auto TickWorld = [World, Movement, Solver, DeltaTime](int32 NumTicks)
+	{
+		for (int32 Tick = 0; Tick < NumTicks; Tick++)
+		{
+			Movement->SetThrottleInput(1.0f);
+			World->Tick(LEVELTICK_All, DeltaTime);
+		}
+
+		// async physics may still be running the last steps
+		Solver->WaitOnPendingTasks_External();
+	};
+
+	// let the vehicle settle onto its suspension and size its scratch storage
+	TickWorld(NumWarmupTicks);
+
+	FSimulationObserver Observer;
+	FCountingMalloc& CountingMalloc = FCountingMalloc::Get();
+	CountingMalloc.Install();
+	IChaosVehicleSimulationObserver::Set(&Observer);
+
+	TickWorld(NumCountedTicks);
+
+	IChaosVehicleSimulationObserver::Set(nullptr);
+	CountingMalloc.Uninstall();
+
+	TestTrue(TEXT("Vehicle simulated by the physics thread"), Observer.NumSimulations.load() > 0);
+	TestEqual(TEXT("Allocations made by the vehicle simulation in steady state"), CountingMalloc.GetNumAllocations(), 0);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
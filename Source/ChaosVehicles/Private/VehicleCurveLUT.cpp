@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "VehicleCurveLUT.h"
+#include "ChaosVehicleMovementComponent.h"
+
+extern FVehicleDebugParams GVehicleDebugParams;
+
+void FVehicleCurveLUT::Bake(const FRichCurve* Curve, int32 Resolution)
+{
+	Reset();
+
+	if (Resolution <= 0)
+	{
+		Resolution = GVehicleDebugParams.CurveLUTResolution;
+	}
+	Resolution = FMath::Max(Resolution, 1);
+
+	if (Curve == nullptr)
+	{
+		Samples.SetNumZeroed(2);
+		return;
+	}
+
+	Curve->GetTimeRange(MinTime, MaxTime);
+	Curve->GetValueRange(MinValue, MaxValue);
+
+	// a single key or an empty curve still produces a table, it's just flat
+	const float SampleSpacing = (MaxTime - MinTime) / Resolution;
+	InvSampleSpacing = (SampleSpacing > SMALL_NUMBER) ? (1.f / SampleSpacing) : 0.f;
+
+	Samples.SetNumUninitialized(Resolution + 1);
+	for (int32 SampleIdx = 0; SampleIdx <= Resolution; SampleIdx++)
+	{
+		Samples[SampleIdx] = Curve->Eval(MinTime + SampleSpacing * SampleIdx);
+	}
+}
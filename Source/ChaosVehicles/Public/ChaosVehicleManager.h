@@ -12,6 +12,7 @@
 
 class UChaosTireConfig;
 class UChaosVehicleMovementComponent;
+class UChaosVehicleSimulation;
 class FChaosScene;
 
 class CHAOSVEHICLES_API FChaosVehicleManager
@@ -21,6 +22,16 @@ public:
 	// Used when values tweaked while the game is running.
 	static uint32 VehicleSetupTag;
 
+	// Updated when a vehicle or wheel setup is edited in a way that can be patched into running vehicles.
+	// Only the vehicles using the edited setup are patched, see NotifyTuningChanged.
+	static uint32 VehicleTuningTag;
+
+	/** Record that a vehicle component or wheel class setup has been edited while the game is running */
+	static void NotifyTuningChanged(const UObject* Setup);
+
+	/** Has this vehicle component or wheel class setup been edited since the given VehicleTuningTag */
+	static bool HasTuningChanged(const UObject* Setup, uint32 SinceTag);
+
 	FChaosVehicleManager(FPhysScene* PhysScene);
 	~FChaosVehicleManager();
 
@@ -37,6 +48,42 @@ public:
 	 */
 	void RemoveVehicle( TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle );
 
+	/**
+	 * Unregister a Physics vehicle, keeping its simulation for reuse by the next vehicle of the same class
+	 */
+	void ParkVehicle( TWeakObjectPtr<UChaosVehicleMovementComponent> Vehicle );
+
+	/**
+	 * Take a simulation parked by a vehicle of the same class as this one, returns null if none is ready
+	 */
+	TUniquePtr<UChaosVehicleSimulation> TakeParkedVehicle(const UChaosVehicleMovementComponent* Vehicle);
+
+	/**
+	 * Keep a copy of a vehicle's newly built simulation for PrewarmVehicles, called before the physics thread has stepped it
+	 */
+	void CaptureVehicleTemplate(const UChaosVehicleMovementComponent* Vehicle);
+
+	/**
+	 * Park copies of the simulation first built for a vehicle's class so up to Count vehicles of that class can spawn without building their own
+	 */
+	void PrewarmVehicles(const UChaosVehicleMovementComponent* Vehicle, int32 Count);
+
+	/** Number of simulations parked for this vehicle's class */
+	int32 GetNumParkedVehicles(const UChaosVehicleMovementComponent* Vehicle) const;
+
+	/** Release all parked simulations, ones the physics thread may still be stepping are released once it has finished with them */
+	void EmptyVehiclePool();
+
+	/**
+	 * Move a registered vehicle in or out of the awake batch, called when its sleep state changes
+	 */
+	void SetVehicleAwake(UChaosVehicleMovementComponent* Vehicle, bool bAwake);
+
+	/**
+	 * Resolve a vehicle handle, returns null if the vehicle has since been removed
+	 */
+	UChaosVehicleMovementComponent* GetVehicle(const FChaosVehicleHandle& Handle) const;
+
 	/**
 	 * Update vehicle tuning and other state such as input
 	 */
@@ -50,6 +97,12 @@ public:
 
 	void ParallelUpdateVehicles(float DeltaSeconds);
 
+	/**
+	 * Queue a game thread suspension trace, all queued traces are issued together as async traces in the next Update.
+	 * The result is passed to the vehicle's SetSuspensionTraceResult once it lands, or a null result if it was dropped, along with VehicleWorldTransform
+	 */
+	void RequestSuspensionTrace(const FChaosVehicleHandle& Vehicle, int32 WheelIndex, const FVector& Start, const FVector& End, float SweepRadius, bool bTraceComplex, const FCollisionResponseContainer& CollisionResponse, const FTransform& VehicleWorldTransform);
+
 	/** Find a vehicle manager from an FPhysScene */
 	static FChaosVehicleManager* GetVehicleManagerFromScene(FPhysScene* PhysScene);
 
@@ -60,13 +113,38 @@ private:
 	/** Map of physics scenes to corresponding vehicle manager */
 	static TMap<FPhysScene*, FChaosVehicleManager*> SceneToVehicleManagerMap;
 
+	/** VehicleTuningTag when each edited setup was last changed */
+	static TMap<TWeakObjectPtr<const UObject>, uint32> TuningChangeTags;
+
 	// The physics scene we belong to
 	FPhysScene_Chaos& Scene;
 
 	static bool GInitialized;
 
-	// All instanced vehicles
+	/** Registry slot, handles index into these and remain stable while the vehicle is registered */
+	struct FVehicleSlot
+	{
+		FVehicleSlot()
+			: Generation(0)
+			, DenseIdx(INDEX_NONE)
+			, NextFreeSlot(INDEX_NONE)
+		{
+		}
+
+		uint32 Generation;		// bumped whenever the slot is freed, invalidates outstanding handles
+		int32 DenseIdx;			// index into Vehicles while in use
+		int32 NextFreeSlot;		// free list link while not in use
+	};
+
+	TArray<FVehicleSlot> VehicleSlots;
+	int32 FirstFreeSlot;
+
+	// All instanced vehicles, densely packed. VehicleSlotIndices runs parallel to this mapping back to the owning slot
 	TArray<TWeakObjectPtr<UChaosVehicleMovementComponent>> Vehicles;
+	TArray<int32> VehicleSlotIndices;
+
+	// Compacted subset of Vehicles that are not sleeping, only these are ticked and simulated
+	TArray<TWeakObjectPtr<UChaosVehicleMovementComponent>> AwakeVehicles;
 
 	FDelegateHandle OnPhysScenePreTickHandle;
 	FDelegateHandle OnPhysScenePostTickHandle;
@@ -77,9 +155,70 @@ private:
 
 	FChaosVehicleManagerAsyncCallback* AsyncCallback;	// Async callback from the physics engine - we can run our simulation here
 	int32 Timestamp;
+	int32 CompletedTimestamp;	// latest input the physics thread has finished simulating, it never returns to older ones
 	int32 SubStepCount;
 
+	// Ring buffer of outputs not yet consumed, sorted by InternalTime. Capacity is a power of two and only grows when full
 	TArray<Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput>> PendingOutputs;
+	int32 PendingOutputsHead;
+	int32 NumPendingOutputs;
+
 	Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput> LatestOutput;
+
+	Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput>& GetPendingOutput(int32 Idx)
+	{
+		return PendingOutputs[(PendingOutputsHead + Idx) & (PendingOutputs.Num() - 1)];
+	}
+
+	void PushPendingOutput(Chaos::TSimCallbackOutputHandle<FChaosVehicleManagerAsyncOutput>&& Output);
+	void PopPendingOutputs(int32 Count);
+
+	/** Deliver the suspension traces that have completed and issue the ones queued since the last update */
+	void UpdateSuspensionTraces(UWorld* World);
+
+	struct FSuspensionTraceRequest
+	{
+		FChaosVehicleHandle Vehicle;
+		int32 WheelIndex;
+		FVector Start;
+		FVector End;
+		float SweepRadius;		// zero for a raycast
+		bool bTraceComplex;
+		FCollisionResponseContainer CollisionResponse;
+		FTransform VehicleWorldTransform;	// vehicle transform the trace was built from, the result is relative to this not to wherever the vehicle is when it lands
+		FTraceHandle TraceHandle;
+	};
+
+	// Suspension traces waiting to be issued and ones waiting on their results
+	TArray<FSuspensionTraceRequest> QueuedSuspensionTraces;
+	TArray<FSuspensionTraceRequest> InFlightSuspensionTraces;
+
+	struct FParkedVehicle
+	{
+		TUniquePtr<UChaosVehicleSimulation> Simulation;
+		uint32 VehicleSetupTag;		// setup the simulation was built from, it is discarded once that changes
+		uint32 VehicleTuningTag;	// tuning the simulation was built or last patched from, it is discarded once any of its setups are edited
+		int32 ReadyTimestamp;		// inputs before this one may still reference it, it is in use until the physics thread has finished them
+	};
+
+	bool IsReady(const FParkedVehicle& Parked) const { return CompletedTimestamp >= Parked.ReadyTimestamp; }
+
+	/** Free a simulation dropped from the pool, or hold it until the physics thread has finished with it */
+	void RetireVehicle(FParkedVehicle&& Parked);
+
+	/** Free the retired simulations the physics thread has finished with */
+	void ReleaseRetiredVehicles();
+
+	/** Drop the parked simulations and template of the vehicle class whose archetype is Setup */
+	void FlushParkedVehicles(const UObject* Setup);
+
+	// Simulations waiting for reuse, keyed by the archetype of the vehicle that built them
+	TMap<TWeakObjectPtr<const UObject>, TArray<FParkedVehicle>> ParkedVehicles;
+
+	// Simulations built from setup data and never stepped, PrewarmVehicles copies these
+	TMap<TWeakObjectPtr<const UObject>, FParkedVehicle> VehicleTemplates;
+
+	// Simulations dropped from the pool that inputs still in flight may reference
+	TArray<FParkedVehicle> RetiredVehicles;
 };
 
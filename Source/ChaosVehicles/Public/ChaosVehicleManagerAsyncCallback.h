@@ -11,10 +11,14 @@
 #include "PhysicsProxy/SingleParticlePhysicsProxyFwd.h"
 #include "Physics/NetworkPhysicsComponent.h"
 #include "ChaosVehicleWheel.h"
+#include "SuspensionQueryBatch.h"
+#include <atomic>
 
 #include "ChaosVehicleManagerAsyncCallback.generated.h"
 
 class UChaosVehicleMovementComponent;
+class UChaosVehicleSimulation;
+struct FVehicleTuningPatch;
 
 DECLARE_STATS_GROUP(TEXT("ChaosVehicleManager"), STATGROUP_ChaosVehicleManager, STATGROUP_Advanced);
 
@@ -24,6 +28,30 @@ enum EChaosAsyncVehicleDataType : int8
 	AsyncDefault,
 };
 
+/** Stable handle to a vehicle registered with the FChaosVehicleManager, the generation guards against reuse of a freed slot */
+struct CHAOSVEHICLES_API FChaosVehicleHandle
+{
+	FChaosVehicleHandle()
+		: Index(INDEX_NONE)
+		, Generation(0)
+	{
+	}
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	void Reset()
+	{
+		Index = INDEX_NONE;
+		Generation = 0;
+	}
+
+	bool operator==(const FChaosVehicleHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FChaosVehicleHandle& Other) const { return !(*this == Other); }
+
+	int32 Index;
+	uint32 Generation;
+};
+
 /** Vehicle inputs from the player controller */
 USTRUCT()
 struct CHAOSVEHICLES_API FVehicleInputs
@@ -292,12 +320,94 @@ struct CHAOSVEHICLES_API FPhysicsVehicleOutput
 	float TransmissionTorque;
 };
 
+/**
+ * Read only view of the wheel outputs, interpolates between the current and next physics outputs on demand instead of copying every field up front.
+ * Only valid until the vehicle manager consumes the next set of physics outputs
+ */
+struct CHAOSVEHICLES_API FVehicleOutputView
+{
+	FVehicleOutputView()
+		: Current(nullptr)
+		, Next(nullptr)
+		, Alpha(0.f)
+	{
+	}
+
+	FVehicleOutputView(const FPhysicsVehicleOutput* InCurrent, const FPhysicsVehicleOutput* InNext = nullptr, float InAlpha = 0.f)
+		: Current(InCurrent)
+		, Next(InNext)
+		, Alpha(InAlpha)
+	{
+	}
+
+	bool IsValid() const { return Current != nullptr; }
+	int32 NumWheels() const { return Current ? Current->Wheels.Num() : 0; }
+
+	bool GetInContact(int32 WheelIdx) const { return Current->Wheels[WheelIdx].InContact; }
+	float GetSteeringAngle(int32 WheelIdx) const { return Lerp(&FWheelsOutput::SteeringAngle, WheelIdx); }
+	float GetAngularVelocity(int32 WheelIdx) const { return Lerp(&FWheelsOutput::AngularVelocity, WheelIdx); }
+	float GetWheelRadius(int32 WheelIdx) const { return Lerp(&FWheelsOutput::WheelRadius, WheelIdx); }
+	float GetSuspensionOffset(int32 WheelIdx) const { return Lerp(&FWheelsOutput::SuspensionOffset, WheelIdx); }
+
+	float GetAngularPosition(int32 WheelIdx) const
+	{
+		const float CurrentAngle = Current->Wheels[WheelIdx].AngularPosition;
+		return Next ? CurrentAngle + FMath::FindDeltaAngleRadians(CurrentAngle, Next->Wheels[WheelIdx].AngularPosition) * Alpha : CurrentAngle;
+	}
+
+	/** Interpolate every field of a single wheel */
+	void GetWheel(int32 WheelIdx, FWheelsOutput& OutWheel) const;
+
+private:
+	template<typename T>
+	T Lerp(T FWheelsOutput::* Field, int32 WheelIdx) const
+	{
+		const T& CurrentValue = Current->Wheels[WheelIdx].*Field;
+		return Next ? FMath::Lerp(CurrentValue, Next->Wheels[WheelIdx].*Field, Alpha) : CurrentValue;
+	}
+
+	const FPhysicsVehicleOutput* Current;
+	const FPhysicsVehicleOutput* Next;
+	float Alpha;
+};
+
 struct CHAOSVEHICLES_API FWheelTraceParams
 {
 	ESweepType SweepType;
 	ESweepShape SweepShape;
 };
 
+/**
+ * Collision query settings for a vehicle's suspension traces. Built on the game thread only when they change and
+ * shared read only with the physics thread, a change swaps in a new instance rather than modifying this one
+ */
+struct CHAOSVEHICLES_API FVehicleTraceQueryParams
+{
+	FVehicleTraceQueryParams()
+		: SimpleTraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), false, nullptr)
+		, ComplexTraceParams(NAME_None, FCollisionQueryParams::GetUnknownStatId(), true, nullptr)
+	{
+	}
+
+	/** Query params matching the requested trace complexity, so they never need to be modified per wheel */
+	const FCollisionQueryParams& GetTraceParams(bool bTraceComplex) const
+	{
+		return bTraceComplex ? ComplexTraceParams : SimpleTraceParams;
+	}
+
+	FCollisionQueryParams SimpleTraceParams;
+	FCollisionQueryParams ComplexTraceParams;
+	FCollisionResponseContainer TraceCollisionResponse;
+	TArray<FWheelTraceParams> WheelTraceParams;
+};
+
+/** Wheel class swapped at runtime, its setup is copied into the vehicle's wheel on the physics thread */
+struct FVehicleWheelClassChange
+{
+	int32 WheelIndex = INDEX_NONE;
+	TSharedPtr<const FChaosVehicleWheelSharedConfig> SharedConfig;
+};
+
 /**
  * Per Vehicle input State from Game Thread to Physics Thread
  */
@@ -305,16 +415,15 @@ struct CHAOSVEHICLES_API FPhysicsVehicleInputs
 {
 	FPhysicsVehicleInputs()
 		: GravityZ(0.0f)
-		, TraceParams()
-		, TraceCollisionResponse()
-		, WheelTraceParams()
+		, bResetSimulation(false)
 	{
 	}
 	float GravityZ;
+	bool bResetSimulation;	// return the simulation to its initial state before this step
 	mutable FNetworkVehicleInputs NetworkInputs;
-	mutable FCollisionQueryParams TraceParams;
-	mutable FCollisionResponseContainer TraceCollisionResponse;
-	mutable TArray<FWheelTraceParams> WheelTraceParams;
+	TSharedPtr<const FVehicleTraceQueryParams, ESPMode::ThreadSafe> TraceQueryParams;
+	TSharedPtr<const FVehicleTuningPatch, ESPMode::ThreadSafe> TuningPatch;	// only set on the step after the vehicle's setup was edited
+	TArray<FVehicleWheelClassChange> WheelClassChanges;	// only set on the step after a wheel class was changed
 };
 
 struct CHAOSVEHICLES_API FPhysicsVehicleTraits
@@ -330,6 +439,7 @@ struct CHAOSVEHICLES_API FChaosVehicleAsyncInput
 {
 	const EChaosAsyncVehicleDataType Type;
 	UChaosVehicleMovementComponent* Vehicle;
+	UChaosVehicleSimulation* Simulation;	// captured on the game thread, the vehicle may hand its simulation back to the pool while this input is in flight
 	Chaos::FSingleParticlePhysicsProxy* Proxy;
 
 	FPhysicsVehicleInputs PhysicsInputs;
@@ -339,16 +449,44 @@ struct CHAOSVEHICLES_API FChaosVehicleAsyncInput
 	*/
 	virtual TUniquePtr<struct FChaosVehicleAsyncOutput> Simulate(UWorld* World, const float DeltaSeconds, const float TotalSeconds, bool& bWakeOut) const;
 
+	/**
+	* Vehicle simulation running on the Physics Thread, writing into an output supplied by the caller
+	*/
+	virtual void Simulate(UWorld* World, const float DeltaSeconds, const float TotalSeconds, bool& bWakeOut, struct FChaosVehicleAsyncOutput& Output) const;
+
 	virtual void ApplyDeferredForces(Chaos::FRigidBodyHandle_Internal* RigidHandle) const;
 
+	/**
+	* Capture the vehicle state ahead of the simulation so its scene queries can be batched with other vehicles, returns false if there is nothing to batch
+	*/
+	virtual bool PrepareBatchedQueries(UWorld* World, const float DeltaSeconds) const;
+
+	/**
+	* Queue up the scene queries captured by PrepareBatchedQueries
+	*/
+	virtual void AddBatchedQueries(FSuspensionQueryBatch& QueryBatch) const;
+
 	FChaosVehicleAsyncInput(EChaosAsyncVehicleDataType InType = EChaosAsyncVehicleDataType::AsyncInvalid)
 		: Type(InType)
 		, Vehicle(nullptr)
+		, Simulation(nullptr)
 	{
 		Proxy = nullptr;	//indicates async/sync task not needed
 	}
 
 	virtual ~FChaosVehicleAsyncInput() = default;
+
+	/** Clear per frame references before this input is returned to the pool */
+	void Reset()
+	{
+		Vehicle = nullptr;
+		Simulation = nullptr;
+		Proxy = nullptr;
+		PhysicsInputs.TraceQueryParams.Reset();
+		PhysicsInputs.TuningPatch.Reset();
+		PhysicsInputs.WheelClassChanges.Reset();
+		PhysicsInputs.bResetSimulation = false;
+	}
 };
 
 struct FChaosVehicleManagerAsyncInput : public Chaos::FSimCallbackInput
@@ -358,11 +496,28 @@ struct FChaosVehicleManagerAsyncInput : public Chaos::FSimCallbackInput
 	TWeakObjectPtr<UWorld> World;
 	int32 Timestamp = INDEX_NONE;
 
+	~FChaosVehicleManagerAsyncInput();
+
+	/** Get a recycled vehicle input, only allocates when the pool is empty */
+	TUniquePtr<FChaosVehicleAsyncInput> AcquireVehicleInput();
+
 	void Reset()
 	{
+		// this object is itself recycled by the sim callback, so keep the vehicle inputs around for the next frame
+		for (TUniquePtr<FChaosVehicleAsyncInput>& VehicleInput : VehicleInputs)
+		{
+			if (VehicleInput)
+			{
+				VehicleInput->Reset();
+				FreeVehicleInputs.Add(MoveTemp(VehicleInput));
+			}
+		}
 		VehicleInputs.Reset();
 		World.Reset();
 	}
+
+private:
+	TArray<TUniquePtr<FChaosVehicleAsyncInput>> FreeVehicleInputs;
 };
 
 /**
@@ -380,6 +535,13 @@ struct CHAOSVEHICLES_API FChaosVehicleAsyncOutput
 	{ }
 
 	virtual ~FChaosVehicleAsyncOutput() = default;
+
+	/** Invalidate before this output is returned to the pool, wheel storage is kept */
+	void Reset()
+	{
+		bValid = false;
+		VehicleSimOutput.Wheels.Reset();
+	}
 };
 
 /**
@@ -390,10 +552,27 @@ struct FChaosVehicleManagerAsyncOutput : public Chaos::FSimCallbackOutput
 	TArray<TUniquePtr<FChaosVehicleAsyncOutput>> VehicleOutputs;
 	int32 Timestamp = INDEX_NONE;
 
+	~FChaosVehicleManagerAsyncOutput();
+
+	/** Get a recycled vehicle output, only allocates when the pool is empty */
+	TUniquePtr<FChaosVehicleAsyncOutput> AcquireVehicleOutput();
+
 	void Reset()
 	{
+		// this object is itself recycled by the sim callback, so keep the vehicle outputs around for the next step
+		for (TUniquePtr<FChaosVehicleAsyncOutput>& VehicleOutput : VehicleOutputs)
+		{
+			if (VehicleOutput)
+			{
+				VehicleOutput->Reset();
+				FreeVehicleOutputs.Add(MoveTemp(VehicleOutput));
+			}
+		}
 		VehicleOutputs.Reset();
 	}
+
+private:
+	TArray<TUniquePtr<FChaosVehicleAsyncOutput>> FreeVehicleOutputs;
 };
 
 /**
@@ -406,4 +585,36 @@ public:
 private:
 	virtual void ProcessInputs_Internal(int32 PhysicsStep) override;
 	virtual void OnPreSimulate_Internal() override;
+
+	/** Suspension traces of all vehicles in the current step, kept between steps to avoid reallocating */
+	FSuspensionQueryBatch SuspensionQueries;
+	TArray<bool> QueriesPrepared;
+
+	/** Flag the vehicles whose forces can be applied in the parallel update, those that are the only vehicle on their body */
+	void FindForcesAppliedInParallel(const TArray<TUniquePtr<FChaosVehicleAsyncInput>>& InputVehiclesBatch);
+
+	TArray<bool> ForcesAppliedInParallel;
+	TSet<const Chaos::FRigidBodyHandle_Internal*> BodyHandles;
+	TSet<const Chaos::FRigidBodyHandle_Internal*> SharedBodyHandles;
+};
+
+#if WITH_DEV_AUTOMATION_TESTS
+/**
+ * Lets automation tests observe each vehicle simulation, the calls are made on the thread running the simulation
+ */
+class CHAOSVEHICLES_API IChaosVehicleSimulationObserver
+{
+public:
+	virtual ~IChaosVehicleSimulationObserver() = default;
+
+	virtual void OnBeginSimulate() = 0;
+	virtual void OnEndSimulate() = 0;
+
+	/** Install an observer or clear it with nullptr, the observer must outlive the physics steps already running */
+	static void Set(IChaosVehicleSimulationObserver* InObserver) { Observer.store(InObserver); }
+	static IChaosVehicleSimulationObserver* Get() { return Observer.load(std::memory_order_relaxed); }
+
+private:
+	static std::atomic<IChaosVehicleSimulationObserver*> Observer;
 };
+#endif
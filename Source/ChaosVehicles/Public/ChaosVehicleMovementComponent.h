@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "Templates/SubclassOf.h"
+#include "Containers/StaticArray.h"
 #include "AI/Navigation/NavigationAvoidanceTypes.h"
 #include "AI/RVOAvoidanceInterface.h"
 #include "Curves/CurveFloat.h"
@@ -16,6 +17,7 @@
 #include "PhysicsProxy/SingleParticlePhysicsProxyFwd.h"
 #include "SnapshotData.h"
 #include "DeferredForces.h"
+#include "VehicleCurveLUT.h"
 #include "ChaosVehicleManagerAsyncCallback.h"
 #include "CollisionQueryParams.h"
 #include "RewindData.h"
@@ -30,6 +32,7 @@ class UCanvas;
 
 struct FChaosVehicleAsyncInput;
 struct FChaosVehicleManagerAsyncOutput;
+class FSuspensionQueryBatch;
 
 struct CHAOSVEHICLES_API FVehicleDebugParams
 {
@@ -51,6 +54,13 @@ struct CHAOSVEHICLES_API FVehicleDebugParams
 	bool EnableMultithreading = true;
 	float SetMaxMPH = 0.0f;
 	float ControlInputWakeTolerance = 0.02f;
+	bool EnableOutputViews = false;
+	bool BatchQueriesAcrossVehicles = false;
+	float QueryBatchCellSize = 2000.0f;
+	int32 CurveLUTResolution = 64;
+	int32 MaxParkedVehicles = 16;
+	bool AccumulateForces = true;
+	bool ParallelApplyForces = true;
 };
 
 struct FBodyInstance;
@@ -315,6 +325,9 @@ struct CHAOSVEHICLES_API FVehicleState
 		, LocalAcceleration(FVector::ZeroVector)
 		, LocalGForce(FVector::ZeroVector)
 		, LastFrameVehicleLocalVelocity(FVector::ZeroVector)
+		, LocalFrameRotation(FQuat4f::Identity)
+		, LocalAngularVelocity(FVector3f::ZeroVector)
+		, LocalCOM(FVector3f::ZeroVector)
 		, ForwardSpeed(0.f)
 		, ForwardsAcceleration(0.f)
 		, NumWheelsOnGround(0)
@@ -346,6 +359,11 @@ struct CHAOSVEHICLES_API FVehicleState
 	FVector LocalGForce;
 	FVector LastFrameVehicleLocalVelocity;
 
+	// Chassis frame in single precision, state relative to the chassis stays small enough for floats wherever the vehicle is in the world
+	FQuat4f LocalFrameRotation;
+	FVector3f LocalAngularVelocity;
+	FVector3f LocalCOM;
+
 	float ForwardSpeed;
 	float ForwardsAcceleration;
 
@@ -395,8 +413,17 @@ struct CHAOSVEHICLES_API FVehicleInputRateConfig
 	UPROPERTY(EditAnywhere, Category = VehicleInputRate)
 	FRuntimeFloatCurve UserCurve;
 
+	/** UserCurve baked for evaluation, rebuilt by the owning component whenever the curve may have changed */
+	UPROPERTY(Transient)
+	FVehicleCurveLUT UserCurveLUT;
+
 	FVehicleInputRateConfig() : RiseRate(5.0f), FallRate(5.0f), InputCurveFunction(EInputFunctionType::LinearFunction) { }
 
+	void BakeCurves()
+	{
+		UserCurveLUT.Bake(UserCurve.GetRichCurveConst());
+	}
+
 	/** Change an output value using max rise and fall rates */
 	float InterpInputValue(float DeltaTime, float CurrentValue, float NewValue) const
 	{
@@ -412,7 +439,7 @@ struct CHAOSVEHICLES_API FVehicleInputRateConfig
 		return CurrentValue + ClampedDeltaValue;
 	}
 
-	float CalcControlFunction(float InputValue)
+	float CalcControlFunction(float InputValue) const
 	{
 		// user defined curve
 
@@ -423,7 +450,8 @@ struct CHAOSVEHICLES_API FVehicleInputRateConfig
 		{
 			if (UserCurve.GetRichCurveConst() && !UserCurve.GetRichCurveConst()->IsEmpty())
 			{
-				float Output = FMath::Clamp(UserCurve.GetRichCurveConst()->Eval(FMath::Abs(InputValue)), 0.0f, 1.0f);
+				const float AbsInput = FMath::Abs(InputValue);
+				float Output = FMath::Clamp(UserCurveLUT.IsBaked() ? UserCurveLUT.Eval(AbsInput) : UserCurve.GetRichCurveConst()->Eval(AbsInput), 0.0f, 1.0f);
 				return (InputValue < 0.f) ? -Output : Output;
 			}
 			else
@@ -616,6 +644,22 @@ private:
 
 };
 
+/**
+ * Setups pushed to the physics thread when a running vehicle's tuning is edited. They replace the setups the vehicle
+ * systems point at, the systems themselves and their state are left alone
+ */
+struct CHAOSVEHICLES_API FVehicleTuningPatch
+{
+	virtual ~FVehicleTuningPatch() = default;
+
+	Chaos::FSimpleAerodynamicsConfig Aerodynamics;
+	TArray<Chaos::FAerofoilConfig> Aerofoils;
+	TArray<Chaos::FSimpleThrustConfig> Thrusters;
+	Chaos::FTorqueControlConfig TorqueControl;
+	Chaos::FTargetRotationControlConfig TargetRotationControl;
+	Chaos::FStabilizeControlConfig StabilizeControl;
+};
+
 class CHAOSVEHICLES_API UChaosVehicleSimulation
 {
 public:
@@ -627,6 +671,8 @@ public:
 	virtual void Init(TUniquePtr<Chaos::FSimpleWheeledVehicle>& PVehicleIn)
 	{
 		PVehicle = MoveTemp(PVehicleIn);
+
+		AerofoilLocalVelocity.SetNum(PVehicle->Aerofoils.Num());
 	}
 
 	virtual void UpdateConstraintHandles(TArray<FPhysicsConstraintHandle>& ConstraintHandlesIn) {}
@@ -642,6 +688,12 @@ public:
 	/** Update the vehicle state */
 	virtual void UpdateState(float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle);
 
+	/** Capture the state needed to build this step's scene queries ahead of the simulation, returns false if the vehicle has nothing to batch */
+	virtual bool PrepareBatchedQueries(UWorld* WorldIn, float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle) { return false; }
+
+	/** Queue up the scene queries captured by PrepareBatchedQueries, results are written back before TickVehicle */
+	virtual void AddBatchedQueries(const FChaosVehicleAsyncInput& InputData, FSuspensionQueryBatch& QueryBatch) {}
+
 	/** Advance the vehicle simulation */
 	virtual void UpdateSimulation(float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle);
 
@@ -681,12 +733,24 @@ public:
 	/** Add a torque to this vehicle */
 	void AddTorqueInRadians(const FVector& Torque, bool bAllowSubstepping = true, bool bAccelChange = false);
 
-	/** Reinitialize a wheel at runtime */
+	/** Reinitialize a wheel at runtime, the setup is copied */
 	void InitializeWheel(int WheelIndex, const Chaos::FSimpleWheelConfig* InWheelSetup);
 
-	/** Reinitialize the physics suspension at runtime */
+	/** Reinitialize the physics suspension at runtime, the setup is copied */
 	void InitializeSuspension(int WheelIndex, const Chaos::FSimpleSuspensionConfig* InSuspensionSetup);
 
+	/** Copy of this simulation's vehicle for the vehicle manager's pool, it points at this vehicle's setup until it is rebound */
+	virtual TUniquePtr<UChaosVehicleSimulation> Clone() const;
+
+	/** Copy the vehicle and the wheel/suspension setups it points at into Other */
+	void CloneVehicle(UChaosVehicleSimulation& Other) const;
+
+	/** Return the vehicle systems and the state carried between steps to how they were when the vehicle was created, without reallocating */
+	virtual void ResetSimulation();
+
+	/** Copy edited setups over the ones the vehicle systems are using */
+	virtual void ApplyTuningPatch(const FVehicleTuningPatch& Patch);
+
 	/** Draw debug text for the wheels and suspension */
 	virtual void DrawDebug3D();
 	UWorld* World;
@@ -699,8 +763,15 @@ public:
 	// #todo: this isn't very configurable
 	TUniquePtr<Chaos::FSimpleWheeledVehicle> PVehicle;
 
+	/** This vehicle's copies of the shared wheel class setups, the wheel and suspension sims point into these */
+	TArray<Chaos::FSimpleWheelConfig> WheelConfigs;
+	TArray<Chaos::FSimpleSuspensionConfig> SuspensionConfigs;
+
 	FDeferredForces DeferredForces;
 
+	/** Velocity at each aerofoil this step, kept with the vehicle so the physics thread tick doesn't allocate */
+	TArray<FVector> AerofoilLocalVelocity;
+
 	/** Current control inputs that is being used on the PT */
 	FControlInputs VehicleInputs;
 
@@ -795,6 +866,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = VehicleSetup, meta = (ClampMin = "0.01", UIMin = "0.01", ClampMax = "1.0", UIMax = "1.0"))
 	float SleepSlopeLimit;
 
+	/** Hand the physics simulation to the vehicle manager when the physics state is destroyed so the next vehicle of this class can reuse it rather than building its own. Only for vehicles whose instances don't override the class setup */
+	UPROPERTY(EditAnywhere, Category = VehicleSetup, AdvancedDisplay)
+	bool bPoolSimulation;
+
 	/** Optional aerofoil setup - can be used for car spoilers or aircraft wings/elevator/rudder */
 	UPROPERTY(EditAnywhere, Category = AerofoilSetup)
 	TArray<FVehicleAerofoilConfig> Aerofoils;
@@ -818,6 +893,9 @@ public:
 	// Used to recreate the physics if the blueprint changes.
 	uint32 VehicleSetupTag;
 
+	// Used to patch the physics setup if this vehicle's or its wheels' tuning changes.
+	uint32 VehicleTuningTag;
+
 protected:
 	// True if the player is holding the handbrake
 	UPROPERTY(Transient)
@@ -847,16 +925,23 @@ public:
 
 	/** UObject interface */
 	virtual void Serialize(FArchive& Ar) override;
+	virtual void PostLoad() override;
 	/** End UObject interface*/
 
 #if WITH_EDITOR
 	/** Respond to a property change in editor */
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	/** Does a change to this property add or remove vehicle systems, rather than only change their setup */
+	virtual bool RequiresVehicleRebuild(const struct FPropertyChangedEvent& PropertyChangedEvent) const;
 #endif //WITH_EDITOR
 
 	/** Overridden to allow registration with components NOT owned by a Pawn. */
 	virtual void SetUpdatedComponent(USceneComponent* NewUpdatedComponent) override;
 
+	/** Bake the curves evaluated at runtime into lookup tables, on the game thread whenever the curves may have changed */
+	virtual void BakeCurves();
+
 	/** Allow the player controller of a different pawn to control this vehicle */
 	virtual void SetOverrideController(AController* OverrideController);
 
@@ -876,9 +961,12 @@ public:
 	/** Used to shut down and physics engine structure for this component */
 	virtual void OnDestroyPhysicsState() override;
 
-	/** Updates the vehicle tuning and other state such as user input. */
+	/** Updates the vehicle state such as user input, only called while the vehicle is awake */
 	virtual void PreTickGT(float DeltaTime);
 
+	/** Rebuild or patch the vehicle if its setup was edited, called every frame whether or not the vehicle is awake */
+	void UpdateSetupChanges();
+
 	/** Stops movement immediately (zeroes velocity, usually zeros acceleration for components with acceleration). */
 	virtual void StopMovementImmediately() override;
 
@@ -1013,8 +1101,20 @@ public:
 		return PVehicleOutput;
 	}
 
+	/** Read view of the latest wheel outputs, falls back to PVehicleOutput when no physics outputs are being referenced */
+	FVehicleOutputView GetOutputView() const
+	{
+		return OutputView.IsValid() ? OutputView : FVehicleOutputView(PVehicleOutput.Get());
+	}
+
+	/** Copy the wheel outputs referenced by the view into PVehicleOutput and drop the view, must happen before the manager releases those outputs */
+	virtual void MaterializeOutputView();
+
 	virtual float GetSuspensionOffset(int WheelIndex) { return 0.f; }
 
+	/** Receives the result of a suspension trace requested through the vehicle manager, null if the trace was dropped. VehicleWorldTransform is the one the trace was requested with */
+	virtual void SetSuspensionTraceResult(int32 WheelIndex, const FHitResult* HitResult, const FTransform& VehicleWorldTransform) {}
+
 	//----ASYNC----
 	TUniquePtr<FChaosVehicleAsyncInput> SetCurrentAsyncInputOutput(int32 InputIdx, FChaosVehicleManagerAsyncOutput* CurOutput, FChaosVehicleManagerAsyncOutput* NextOutput, float Alpha, int32 VehicleManagerTimestamp);
 
@@ -1036,6 +1136,9 @@ public:
 	struct FChaosVehicleAsyncOutput* NextAsyncOutput;
 	float OutputInterpAlpha;
 
+	// References the physics outputs retained by the vehicle manager instead of copying the wheels into PVehicleOutput, see p.Vehicle.EnableOutputViews
+	FVehicleOutputView OutputView;
+
 	struct FAsyncOutputWrapper
 	{
 		int32 Idx;
@@ -1047,7 +1150,33 @@ public:
 		{
 		}
 	};
-	TArray<FAsyncOutputWrapper> OutputsWaitingOn;
+
+	/** Number of in flight outputs tracked per vehicle, must be a power of two */
+	static constexpr int32 MaxOutputsWaitingOn = 32;
+
+	// Ring buffer of the input index used for each manager timestamp, slot is Timestamp modulo MaxOutputsWaitingOn
+	TStaticArray<FAsyncOutputWrapper, MaxOutputsWaitingOn> OutputsWaitingOn;
+
+	/** Find the input index this vehicle used at the given manager timestamp, INDEX_NONE if not found */
+	int32 FindOutputWaitingOn(int32 Timestamp) const
+	{
+		const FAsyncOutputWrapper& Wrapper = OutputsWaitingOn[Timestamp & (MaxOutputsWaitingOn - 1)];
+		return (Wrapper.Timestamp == Timestamp) ? Wrapper.Idx : INDEX_NONE;
+	}
+
+	void ResetOutputsWaitingOn()
+	{
+		for (FAsyncOutputWrapper& Wrapper : OutputsWaitingOn)
+		{
+			Wrapper = FAsyncOutputWrapper();
+		}
+	}
+
+	// Registration with the vehicle manager, invalid while not registered
+	FChaosVehicleHandle VehicleHandle;
+
+	// Index into the vehicle manager's awake batch, INDEX_NONE while sleeping
+	int32 AwakeVehicleIdx;
 
 protected:
 
@@ -1207,6 +1336,16 @@ protected:
 	/** Option to aggressively sleep the vehicle */
 	virtual void ProcessSleeping(const FControlInputs& ControlInputs);
 
+	/** Set VehicleState.bSleeping, keeping the vehicle manager's awake batch in sync */
+	void SetSleepingState(bool bInSleeping);
+
+	/** Wake a sleeping vehicle if a control input has changed by more than the wake tolerance */
+	void WakeOnControlInput(float NewInput, float OldInput);
+
+	/** Physics has woken the vehicle body, i.e. something collided with it */
+	UFUNCTION()
+	void OnBodyWake(UPrimitiveComponent* WakingComponent, FName BoneName);
+
 	/** Pass current state to server */
 	UFUNCTION(reliable, server, WithValidation)
 	void ServerUpdateState(float InSteeringInput, float InThrottleInput, float InBrakeInput
@@ -1243,6 +1382,27 @@ protected:
 	/** Do some final setup after the Chaos vehicle gets created */
 	virtual void PostSetupVehicle();
 
+	/** Reuse a simulation parked with the vehicle manager by another vehicle of this class, returns false if there is none to take */
+	bool TakeParkedVehicle();
+
+	/** Point a parked vehicle's systems at this component's setup and recompute the data SetupVehicle would have, returns false if it doesn't fit this setup */
+	virtual bool RebindVehicle(Chaos::FSimpleWheeledVehicle& PVehicle);
+
+	/** Can the simulation be handed to another vehicle of this class when the physics state is destroyed */
+	bool CanParkVehicle() const;
+
+	/** Has the setup of this vehicle, its archetype or anything else it was built from, been edited since SinceTag */
+	virtual bool IsTuningChanged(uint32 SinceTag) const;
+
+	/** Queue a patch for the physics thread if this vehicle's tuning was edited */
+	void UpdateTuning();
+
+	/** Gather the current setups to patch into the running vehicle */
+	virtual TSharedPtr<FVehicleTuningPatch, ESPMode::ThreadSafe> CreateTuningPatch();
+
+	/** Fill in the setups owned by this class, the physics thread is still reading ours so they are built separately */
+	virtual void FillTuningPatch(FVehicleTuningPatch& Patch);
+
 	/** Adjust the Chaos Physics mass */
 	virtual void SetupVehicleMass();
 
@@ -1278,6 +1438,16 @@ protected:
 
 	TUniquePtr<UChaosVehicleSimulation> VehicleSimulationPT;	/* simulation code running on the physics thread async callback */
 
+	bool bVehicleSetupModified;	/* simulation setup was changed at runtime so it no longer matches the class */
+
+	TSharedPtr<const FVehicleTuningPatch, ESPMode::ThreadSafe> PendingTuningPatch;	/* sent with the next async input */
+
+	TArray<FVehicleWheelClassChange> PendingWheelClassChanges;	/* sent with the next async input */
+
+	bool bPendingSimulationReset;	/* sent with the next async input */
+
+	bool bForcedWakeEvents;	/* wake events were turned on so a sleeping vehicle is woken, they are turned back off when the physics state is destroyed */
+
 	UPROPERTY(transient, Replicated)
 	TObjectPtr<AController> OverrideController;
 
@@ -1289,9 +1459,14 @@ protected:
 
 	void FillAerodynamicsSetup()
 	{
-		PAerodynamicsSetup.DragCoefficient = this->DragCoefficient;
-		PAerodynamicsSetup.DownforceCoefficient = this->DownforceCoefficient;
-		PAerodynamicsSetup.AreaMetresSquared = Chaos::Cm2ToM2(this->DragArea);
+		FillAerodynamicsSetup(PAerodynamicsSetup);
+	}
+
+	void FillAerodynamicsSetup(Chaos::FSimpleAerodynamicsConfig& OutSetup) const
+	{
+		OutSetup.DragCoefficient = this->DragCoefficient;
+		OutSetup.DownforceCoefficient = this->DownforceCoefficient;
+		OutSetup.AreaMetresSquared = Chaos::Cm2ToM2(this->DragArea);
 	}
 
 	void WakeAllEnabledRigidBodies();
@@ -66,6 +66,14 @@ class UChaosWheeledVehicleMovementComponent;
 		Additive
 	};
 
+	/** Physics setup of a wheel class, shared by every vehicle using the class and never modified once built */
+	struct CHAOSVEHICLES_API FChaosVehicleWheelSharedConfig
+	{
+		Chaos::FSimpleWheelConfig WheelConfig;
+		Chaos::FSimpleSuspensionConfig SuspensionConfig;
+		uint32 VehicleSetupTag = 0;
+	};
+
 	UCLASS(BlueprintType, Blueprintable)
 		class CHAOSVEHICLES_API UChaosVehicleWheel : public UObject
 	{
@@ -374,8 +382,6 @@ class UChaosWheeledVehicleMovementComponent;
 			{
 				for (float X = 0; X <= MaxTime; X += (MaxTime / NumSamples))
 				{
-					float MinVal = 0.f, MaxVal = 0.f;
-					this->LateralSlipGraph.GetRichCurveConst()->GetValueRange(MinVal, MaxVal);
 					float Y = this->LateralSlipGraph.GetRichCurveConst()->Eval(X) * 10000.0f;
 					PWheelConfig.LateralSlipGraph.Add(Chaos::FVec2(X, Y));
 				}
@@ -420,6 +426,12 @@ class UChaosWheeledVehicleMovementComponent;
 			return PSuspensionConfig;
 		}
 
+		/**
+		 * Get the physics setup shared by every wheel of WheelClass. It is built from the class default object the first time
+		 * it is requested and again whenever FChaosVehicleManager::VehicleSetupTag changes. Game thread only
+		 */
+		static TSharedPtr<const FChaosVehicleWheelSharedConfig> GetSharedConfig(TSubclassOf<UChaosVehicleWheel> WheelClass);
+
 		/** Get contact surface material */
 		UPhysicalMaterial* GetContactSurfaceMaterial();
 
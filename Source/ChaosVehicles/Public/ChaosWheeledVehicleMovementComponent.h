@@ -40,6 +40,16 @@ struct CHAOSVEHICLES_API FWheeledVehicleDebugParams
 
 	float OverlapTestExpansionXY = 100.f;
 	float OverlapTestExpansionZ = 50.f;
+	float OverlapCachePredictionTime = 0.25f;
+	float OverlapCacheMaxPrediction = 2000.f;
+
+	bool EnableTraceReuse = false;
+	float TraceReuseTolerance = 1.0f;
+	int32 TraceReuseMaxSteps = 8;
+	bool EnableHeightfieldContacts = false;
+	bool EnableAsyncSuspensionOffsetTraces = false;
+	bool EnableVectorWheelFrames = false;
+	bool EnableLocalSpaceWheelState = false;
 };
 
 /**
@@ -256,6 +266,10 @@ struct CHAOSVEHICLES_API FVehicleEngineConfig
 	UPROPERTY(EditAnywhere, Category = Setup, meta = (ClampMin = "0.01", UIMin = "0.01"))
 	float EngineRevDownRate;
 
+	/** TorqueCurve baked for evaluation, rebuilt by the owning component whenever the curve may have changed */
+	UPROPERTY(Transient)
+	FVehicleCurveLUT TorqueCurveLUT;
+
 	const Chaos::FSimpleEngineConfig& GetPhysicsEngineConfig()
 	{
 		FillEngineSetup();
@@ -272,13 +286,23 @@ struct CHAOSVEHICLES_API FVehicleEngineConfig
 		EngineRevDownRate = 600.0f;
 	}
 
-	float GetTorqueFromRPM(float EngineRPM)
+	void BakeCurves()
+	{
+		TorqueCurveLUT.Bake(TorqueCurve.GetRichCurveConst());
+	}
+
+	float GetTorqueFromRPM(float EngineRPM) const
 	{
 		// The source curve does not need to be normalized, however we are normalizing it when it is passed on,
 		// since it's the MaxRPM and MaxTorque values that determine the range of RPM and Torque
+		if (TorqueCurveLUT.IsBaked())
+		{
+			return TorqueCurveLUT.Eval(EngineRPM) / TorqueCurveLUT.GetMaxValue() * MaxTorque;
+		}
+
 		float MinVal = 0.f, MaxVal = 0.f;
 		this->TorqueCurve.GetRichCurveConst()->GetValueRange(MinVal, MaxVal);
-		return TorqueCurve.GetRichCurve()->Eval(EngineRPM) / MaxVal * MaxTorque;
+		return TorqueCurve.GetRichCurveConst()->Eval(EngineRPM) / MaxVal * MaxTorque;
 	}
 private:
 
@@ -288,10 +312,10 @@ private:
 		// since it's the MaxRPM and MaxTorque values that determine the range of RPM and Torque
 		PEngineConfig.TorqueCurve.Empty();
 		float NumSamples = 20;
+		float MinVal = 0.f, MaxVal = 0.f;
+		this->TorqueCurve.GetRichCurveConst()->GetValueRange(MinVal, MaxVal);
 		for (float X = 0; X <= this->MaxRPM; X+= (this->MaxRPM / NumSamples))
 		{ 
-			float MinVal = 0.f, MaxVal = 0.f;
-			this->TorqueCurve.GetRichCurveConst()->GetValueRange(MinVal, MaxVal);
 			float Y = this->TorqueCurve.GetRichCurveConst()->Eval(X) / MaxVal;
 			PEngineConfig.TorqueCurve.AddNormalized(Y);
 		}
@@ -544,12 +568,19 @@ struct CHAOSVEHICLES_API FWheelState
 		LocalWheelVelocity.Init(FVector::ZeroVector, NumWheels);
 		Trace.SetNum(NumWheels);
 		TraceResult.SetNum(NumWheels);
+		CachedTrace.SetNum(NumWheels);
+		TraceReused.Init(false, NumWheels);
+		CachedTraceReusable.Init(false, NumWheels);
+		TraceReuseCount.Init(0, NumWheels);
+		WheelLoad.Init(0.f, NumWheels);
 	}
 
 	/** Commonly used Wheel state - evaluated once used wherever required for that frame */
 	void CaptureState(int WheelIdx, const FVector& WheelOffset, const FBodyInstance* TargetInstance);
 	void CaptureState(int WheelIdx, const FVector& WheelOffset, const Chaos::FRigidBodyHandle_Internal* Handle);
 	void CaptureState(int WheelIdx, const FVector& WheelOffset, const Chaos::FRigidBodyHandle_Internal* VehicleHandle, const FVector& ContactPoint, const Chaos::FRigidBodyHandle_Internal* SurfaceHandle);
+	/** Capture relative to the chassis frame already captured in VehicleState, in single precision */
+	void CaptureState(int WheelIdx, const FVector& WheelOffset, const FVehicleState& VehicleState);
 	static FVector GetVelocityAtPoint(const Chaos::FRigidBodyHandle_Internal* Rigid, const FVector& InPoint);
 
 	TArray<FVector> WheelLocalLocation;	/** Current Location Of Wheels In Local Coordinates */
@@ -558,6 +589,29 @@ struct CHAOSVEHICLES_API FWheelState
 	TArray<FVector> LocalWheelVelocity; /** Local velocity of Wheel */
 	TArray<Chaos::FSuspensionTrace> Trace;
 	TArray<FHitResult> TraceResult;
+	TArray<Chaos::FSuspensionTrace> CachedTrace;	/** Trace that produced the current TraceResult */
+	TArray<bool> TraceReused;	/** TraceResult was carried over from the previous step rather than traced */
+	TArray<bool> CachedTraceReusable;	/** CachedTrace hit something static, captured when it was traced */
+	TArray<int32> TraceReuseCount;	/** Steps TraceResult has been carried over for since it was last traced */
+	TArray<float> WheelLoad;	/** Load on each wheel from its suspension, zero when not in contact */
+};
+
+/** Tuning patch for wheeled vehicles, the wheel and suspension setups are per wheel and already adjusted for this vehicle */
+struct CHAOSVEHICLES_API FWheeledVehicleTuningPatch : public FVehicleTuningPatch
+{
+	Chaos::FSimpleEngineConfig Engine;
+	Chaos::FSimpleTransmissionConfig Transmission;
+	Chaos::FSimpleDifferentialConfig Differential;
+	Chaos::FSimpleSteeringConfig Steering;
+
+	// empty when the wheels were changed at runtime and should keep their setups
+	TArray<Chaos::FSimpleWheelConfig> Wheels;
+	TArray<Chaos::FSimpleSuspensionConfig> Suspension;
+	TArray<FVector> SuspensionRestingPositions;
+	TArray<float> RollbarScaling;	// per axle
+	int32 NumDrivenWheels = 0;
+
+	bool bLegacyWheelFrictionPosition = false;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -568,6 +622,8 @@ public:
 
 	UChaosWheeledVehicleSimulation()
 		: bOverlapHit(false)
+		, bOverlapTraceComplex(false)
+		, bSuspensionTracesBatched(false)
 	{
 		QueryBox.Init();
 	}
@@ -585,6 +641,12 @@ public:
 
 	virtual void UpdateConstraintHandles(TArray<FPhysicsConstraintHandle>& ConstraintHandlesIn) override;
 
+	virtual TUniquePtr<UChaosVehicleSimulation> Clone() const override;
+
+	virtual void ResetSimulation() override;
+
+	virtual void ApplyTuningPatch(const FVehicleTuningPatch& Patch) override;
+
 	virtual void TickVehicle(UWorld* WorldIn, float DeltaTime, const FChaosVehicleAsyncInput& InputData, FChaosVehicleAsyncOutput& OutputData, Chaos::FRigidBodyHandle_Internal* Handle) override;
 
 	/** Advance the vehicle simulation */
@@ -593,6 +655,10 @@ public:
 	/** Update the vehicle state */
 	virtual void UpdateState(float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle) override;
 
+	virtual bool PrepareBatchedQueries(UWorld* WorldIn, float DeltaTime, const FChaosVehicleAsyncInput& InputData, Chaos::FRigidBodyHandle_Internal* Handle) override;
+
+	virtual void AddBatchedQueries(const FChaosVehicleAsyncInput& InputData, FSuspensionQueryBatch& QueryBatch) override;
+
 	virtual void FillOutputState(FChaosVehicleAsyncOutput& Output) override;
 
 	/** Are enough vehicle systems specified such that physics vehicle simulation is possible */
@@ -601,8 +667,17 @@ public:
 	/** Pass control Input to the vehicle systems */
 	virtual void ApplyInput(const FControlInputs& ControlInputs, float DeltaTime) override;
 
+	/** Cache the wheel state and suspension trace locations for this frame */
+	void CaptureWheelState(Chaos::FRigidBodyHandle_Internal* Handle);
+
+	/** Carry over last step's hit for wheels that have barely moved over a static surface, returns the number of wheels that do not need tracing */
+	int32 ReuseSuspensionTraces(const TArray<Chaos::FSuspensionTrace>& SuspensionTrace, const TArray<FWheelTraceParams>& WheelTraceParams);
+
+	/** Reproject a cached hit onto the plane it was found on using this step's trace */
+	bool ReprojectTraceResult(FHitResult& HitResult, const Chaos::FSuspensionTrace& Trace, float SweepRadius) const;
+
 	/** Perform suspension ray/shape traces */
-	virtual void PerformSuspensionTraces(const TArray<Chaos::FSuspensionTrace>& SuspensionTrace, FCollisionQueryParams& TraceParams, FCollisionResponseContainer& CollisionResponse, TArray<FWheelTraceParams>& WheelTraceParams);
+	virtual void PerformSuspensionTraces(const TArray<Chaos::FSuspensionTrace>& SuspensionTrace, const FVehicleTraceQueryParams& QueryParams);
 
 
 	/** Update the engine/transmission simulation */
@@ -614,8 +689,14 @@ public:
 	/** calculate and apply lateral and longitudinal friction forces from wheels */
 	virtual void ApplyWheelFrictionForces(float DeltaTime);
 
+	/** ApplyWheelFrictionForces with the steering and ground contact frames of four wheels at a time worked out in vector registers */
+	void ApplyWheelFrictionForcesVectorized(float DeltaTime);
+
+	/** Debug draw the drive and friction forces of a wheel in contact */
+	void DrawWheelFrictionForces(int WheelIdx, const FMatrix& GroundFrame, const FVector& FrictionForceVector);
+
 	/** calculate and apply chassis suspension forces */
-	virtual void ApplySuspensionForces(float DeltaTime, TArray<FWheelTraceParams>& WheelTraceParams);
+	virtual void ApplySuspensionForces(float DeltaTime, const TArray<FWheelTraceParams>& WheelTraceParams);
 
 	bool IsWheelSpinning() const;
 	bool ContainsTraces(const FBox& Box, const TArray<struct Chaos::FSuspensionTrace>& SuspensionTrace);
@@ -630,8 +711,13 @@ public:
 
 	// cache trace overlap query
 	TArray<FOverlapResult> OverlapResults;
+	TArray<FBox> OverlapBounds;	// world bounds of each OverlapResults component when the overlap was made
 	bool bOverlapHit;
+	bool bOverlapTraceComplex;	// the overlap was made against complex collision
 	FBox QueryBox;
+
+	// set when this step's state was captured and traces resolved by the manager's batched query stage
+	bool bSuspensionTracesBatched;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -726,6 +812,7 @@ class CHAOSVEHICLES_API UChaosWheeledVehicleMovementComponent : public UChaosVeh
 	}
 
 	virtual float GetSuspensionOffset(int WheelIndex) override;
+	virtual void SetSuspensionTraceResult(int32 WheelIndex, const FHitResult* HitResult, const FTransform& VehicleWorldTransform) override;
 	UPhysicalMaterial* GetPhysMaterial(int WheelIndex);
 
 	/** Set all channels to the specified response - for wheel raycasts */
@@ -754,6 +841,8 @@ class CHAOSVEHICLES_API UChaosWheeledVehicleMovementComponent : public UChaosVeh
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	virtual bool RequiresVehicleRebuild(const struct FPropertyChangedEvent& PropertyChangedEvent) const override;
 #endif
 	/** Are the configuration references configured sufficiently that the vehicle can be created */
 	virtual bool CanCreateVehicle() const override;
@@ -877,6 +966,9 @@ class CHAOSVEHICLES_API UChaosWheeledVehicleMovementComponent : public UChaosVeh
 	/** Allocate and setup the Chaos vehicle */
 	virtual void SetupVehicle(TUniquePtr<Chaos::FSimpleWheeledVehicle>& PVehicle) override;
 
+	/** Point a parked vehicle's systems at this component's setup */
+	virtual bool RebindVehicle(Chaos::FSimpleWheeledVehicle& PVehicle) override;
+
 	virtual void ResetVehicleState() override;
 
 protected:
@@ -890,6 +982,9 @@ protected:
 	/** Skeletal mesh needs some special handling in the vehicle case */
 	virtual void FixupSkeletalMesh();
 
+	/** Bake the engine torque curve as well as the input curves */
+	virtual void BakeCurves() override;
+
 	/** Create and setup the Chaos vehicle */
 	virtual void CreateVehicle();
 
@@ -904,6 +999,20 @@ protected:
 
 	/** Setup calculated suspension parameters */
 	void SetupSuspension(TUniquePtr<Chaos::FSimpleWheeledVehicle>& PVehicle);
+	void SetupSuspension(TArray<Chaos::FSimpleSuspensionSim>& SuspensionSims);
+
+	/** Enable the engine on the wheel if its axle is driven by the differential */
+	void SetupWheelEngineEnabled(Chaos::FSimpleWheelSim& WheelSim, UChaosVehicleWheel* Wheel) const;
+
+	/** Override the wheels' TorqueRatio & EngineEnabled from the vehicle differential settings */
+	void SetupWheelTorqueRatios(TArray<Chaos::FSimpleWheelSim>& WheelSims, const Chaos::FSimpleDifferentialSim& DifferentialSim) const;
+
+	/** Also checks the wheel classes */
+	virtual bool IsTuningChanged(uint32 SinceTag) const override;
+
+	virtual TSharedPtr<FVehicleTuningPatch, ESPMode::ThreadSafe> CreateTuningPatch() override;
+
+	virtual void FillTuningPatch(FVehicleTuningPatch& Patch) override;
 
 	/** Maps UChaosVehicleWheel Axle to a wheel index */
 	void RecalculateAxles();
@@ -918,6 +1027,9 @@ protected:
 	/* Fill Async input state */
 	virtual void Update(float DeltaTime) override;
 
+	/** Suspension trace query settings shared with the physics thread, rebuilt only when the owner, responses or wheel sweep settings change */
+	const TSharedPtr<const FVehicleTraceQueryParams, ESPMode::ThreadSafe>& GetTraceQueryParams();
+
 	//////////////////////////////////////////////////////////////////////////
 	// Debug
 
@@ -936,6 +1048,12 @@ protected:
 	/** Get distances between wheels - primarily a debug display helper */
 	FVector2D CalculateWheelLayoutDimensions();
 
+	/** Suspension offset implied by a game thread suspension trace */
+	float GetTracedSuspensionOffset(const UChaosVehicleWheel* Wheel, const FChaosWheelSetup& WheelSetup, const FTransform& VehicleWorldTransform, const FHitResult& HitResult);
+
+	/** Unclamped suspension offset of a wheel from its contact point in vehicle local space */
+	static float CalcSuspensionOffset(ESweepShape SweepShape, const FVector& LocalHitPoint, const FVector& LocalPos, float Radius);
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	float CalcDialAngle(float CurrentValue, float MaxValue);
 	void DrawDial(UCanvas* Canvas, FVector2D Pos, float Radius, float CurrentValue, float MaxValue);
@@ -943,11 +1061,12 @@ protected:
 
 	struct FCachedState
 	{
-		FCachedState() : WheelOffset(0.f), bIsValid(false)
+		FCachedState() : WheelOffset(0.f), bIsValid(false), bTracePending(false)
 		{ }
 
 		float WheelOffset;
 		bool bIsValid;
+		bool bTracePending;	// waiting on a trace requested through the vehicle manager
 	};
 
 	static EDebugPages DebugPage;
@@ -957,6 +1076,8 @@ protected:
 	TArray<FPhysicsConstraintHandle> ConstraintHandles;
 	TArray<FWheelStatus> WheelStatus; /** Wheel output status */
 	TArray<FCachedState> CachedState;
+	TSharedPtr<const FVehicleTraceQueryParams, ESPMode::ThreadSafe> TraceQueryParams;
+	TWeakObjectPtr<AActor> TraceQueryParamsOwner;
 	Chaos::FPerformanceMeasure PerformanceMeasure;
 };
 
@@ -102,34 +102,116 @@ public:
 		FVector Position;
 	};
 
+	FDeferredForces()
+		: bAccumulate(false)
+	{
+	}
+
+	/**
+	 * Sum the forces into a single net force, torque, linear and angular impulse as they are added rather than queueing each one,
+	 * Apply is then a fixed number of writes to the body however many forces were added
+	 */
+	void SetAccumulate(bool bAccumulateIn)
+	{
+		bAccumulate = bAccumulateIn;
+	}
+
+	bool IsAccumulating() const
+	{
+		return bAccumulate;
+	}
+
 	void Add(const FApplyForceData& ApplyForceDataIn)
 	{
-		ApplyForceDatas.Add(ApplyForceDataIn);
+		if (bAccumulate)
+		{
+			FVector& NetForce = EnumHasAnyFlags(ApplyForceDataIn.Flags, EForceFlags::AccelChange) ? Net.Acceleration : Net.Force;
+			NetForce += ApplyForceDataIn.Force;
+			Net.bHasForce = true;
+		}
+		else
+		{
+			ApplyForceDatas.Add(ApplyForceDataIn);
+		}
 	}
 
 	void Add(const FApplyForceAtPositionData& ApplyForceAtPositionDataIn)
 	{
-		ApplyForceAtPositionDatas.Add(ApplyForceAtPositionDataIn);
+		if (bAccumulate)
+		{
+			Net.Force += ApplyForceAtPositionDataIn.Force;
+			Net.PositionalForce += ApplyForceAtPositionDataIn.Force;
+			Net.Moment += FVector::CrossProduct(GetMomentOrigin(ApplyForceAtPositionDataIn.Position), ApplyForceAtPositionDataIn.Force);
+			Net.bHasForce = true;
+		}
+		else
+		{
+			ApplyForceAtPositionDatas.Add(ApplyForceAtPositionDataIn);
+		}
 	}
 
 	void Add(const FAddTorqueInRadiansData& ApplyTorqueDataIn)
 	{
-		ApplyTorqueDatas.Add(ApplyTorqueDataIn);
+		if (bAccumulate)
+		{
+			FVector& NetTorque = EnumHasAnyFlags(ApplyTorqueDataIn.Flags, EForceFlags::AccelChange) ? Net.AngularAcceleration : Net.Torque;
+			NetTorque += ApplyTorqueDataIn.Torque;
+			Net.bHasForce = true;
+		}
+		else
+		{
+			ApplyTorqueDatas.Add(ApplyTorqueDataIn);
+		}
 	}
 
 	void Add(const FAddImpulseData& ApplyImpulseDataIn)
 	{
-		ApplyImpulseDatas.Add(ApplyImpulseDataIn);
+		if (bAccumulate)
+		{
+			FVector& NetImpulse = EnumHasAnyFlags(ApplyImpulseDataIn.Flags, EForceFlags::VelChange) ? Net.VelocityChange : Net.LinearImpulse;
+			NetImpulse += ApplyImpulseDataIn.Impulse;
+			Net.bHasImpulse = true;
+		}
+		else
+		{
+			ApplyImpulseDatas.Add(ApplyImpulseDataIn);
+		}
 	}
 
 	void Add(const FAddImpulseAtPositionData& ApplyImpulseAtPositionDataIn)
 	{
-		ApplyImpulseAtPositionDatas.Add(ApplyImpulseAtPositionDataIn);
+		if (bAccumulate)
+		{
+			Net.LinearImpulse += ApplyImpulseAtPositionDataIn.Impulse;
+			Net.PositionalImpulse += ApplyImpulseAtPositionDataIn.Impulse;
+			Net.AngularImpulse += FVector::CrossProduct(GetMomentOrigin(ApplyImpulseAtPositionDataIn.Position), ApplyImpulseAtPositionDataIn.Impulse);
+			Net.bHasImpulse = true;
+		}
+		else
+		{
+			ApplyImpulseAtPositionDatas.Add(ApplyImpulseAtPositionDataIn);
+		}
 	}
 
 
+	/** Drop any queued forces without applying them */
+	void Reset()
+	{
+		ApplyForceDatas.Reset();
+		ApplyForceAtPositionDatas.Reset();
+		ApplyTorqueDatas.Reset();
+		ApplyImpulseDatas.Reset();
+		ApplyImpulseAtPositionDatas.Reset();
+		Net = FNetForces();
+	}
+
 	void Apply(Chaos::FRigidBodyHandle_Internal* RigidHandle)
 	{
+		if (Net.bHasForce || Net.bHasImpulse)
+		{
+			ApplyNetForces(RigidHandle);
+		}
+
 		for (const FApplyForceData& Data : ApplyForceDatas)
 		{
 			AddForce(RigidHandle, Data);
@@ -155,15 +237,47 @@ public:
 			AddImpulseAtPosition(RigidHandle, Data);
 		}
 
-		ApplyForceDatas.Empty();
-		ApplyForceAtPositionDatas.Empty();
-		ApplyTorqueDatas.Empty();
-		ApplyImpulseDatas.Empty();
-		ApplyImpulseAtPositionDatas.Empty();
+		// keep the allocations, the same number of forces will be added next step
+		Reset();
 	}
 
 private:
 
+	/** Forces and impulses summed since the last Apply, moments are taken about MomentOrigin */
+	struct FNetForces
+	{
+		FVector Force = FVector::ZeroVector;
+		FVector Acceleration = FVector::ZeroVector;
+		FVector Torque = FVector::ZeroVector;
+		FVector AngularAcceleration = FVector::ZeroVector;
+		FVector PositionalForce = FVector::ZeroVector;
+		FVector Moment = FVector::ZeroVector;
+
+		FVector LinearImpulse = FVector::ZeroVector;
+		FVector VelocityChange = FVector::ZeroVector;
+		FVector PositionalImpulse = FVector::ZeroVector;
+		FVector AngularImpulse = FVector::ZeroVector;
+
+		FVector MomentOrigin = FVector::ZeroVector;
+		bool bHasMomentOrigin = false;
+		bool bHasForce = false;
+		bool bHasImpulse = false;
+	};
+
+	/** Offset of Position from the point moments are summed about, the first position added so the offsets stay small in large worlds */
+	FVector GetMomentOrigin(const FVector& Position)
+	{
+		if (!Net.bHasMomentOrigin)
+		{
+			Net.MomentOrigin = Position;
+			Net.bHasMomentOrigin = true;
+		}
+
+		return Position - Net.MomentOrigin;
+	}
+
+	void ApplyNetForces(Chaos::FRigidBodyHandle_Internal* RigidHandle);
+
 	void AddForce(Chaos::FRigidBodyHandle_Internal* RigidHandle, const FApplyForceData& DataIn);
 	void AddForceAtPosition(Chaos::FRigidBodyHandle_Internal* RigidHandle, const FApplyForceAtPositionData& DataIn);
 	void AddTorque(Chaos::FRigidBodyHandle_Internal* RigidHandle, const FAddTorqueInRadiansData& DataIn);
@@ -175,4 +289,7 @@ private:
 	TArray<FAddTorqueInRadiansData> ApplyTorqueDatas;
 	TArray<FAddImpulseData> ApplyImpulseDatas;
 	TArray<FAddImpulseAtPositionData> ApplyImpulseAtPositionDatas;
+
+	FNetForces Net;
+	bool bAccumulate;
 };
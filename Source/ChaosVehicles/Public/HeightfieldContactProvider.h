@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Resolves suspension traces against landscape heightfields by sampling the height data directly, with bilinear
+ * interpolation between the four surrounding samples, rather than running a generic query against the collision geometry
+ */
+class CHAOSVEHICLES_API FHeightfieldContactProvider
+{
+public:
+
+	/** True if the component's collision is a heightfield that can be sampled directly */
+	static bool IsHeightfield(const UPrimitiveComponent* Component);
+
+	/**
+	 * Find where a ray (zero SweepRadius) or sphere moving from Start to End first touches the heightfield. Sphere sweeps start
+	 * one radius back from Start to match the suspension traces. OutHit.bBlockingHit is set when there is contact.
+	 * Returns false when the trace can't be resolved here, e.g. it is outside the heightfield or over a hole, and a generic trace should be used
+	 */
+	static bool Trace(UPrimitiveComponent* Component, const FVector& Start, const FVector& End, float SweepRadius, FHitResult& OutHit);
+};
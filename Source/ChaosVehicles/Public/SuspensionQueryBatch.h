@@ -0,0 +1,62 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+#include "Engine/OverlapResult.h"
+
+class UWorld;
+
+/**
+ * Gathers the suspension traces of every vehicle simulated in a physics step and resolves them together.
+ * Traces are sorted into spatial cells, each cell performs a single broad phase overlap that is shared by
+ * all of the wheels inside it, so the acceleration structure is walked once per cell rather than once per vehicle
+ */
+class CHAOSVEHICLES_API FSuspensionQueryBatch
+{
+public:
+
+	struct FQuery
+	{
+		FVector Start;
+		FVector End;
+		float SweepRadius;		// zero for a raycast
+		bool bTraceComplex;
+		uint32 ResponseHash;
+		uint64 CellKey;
+		const FCollisionQueryParams* TraceParams;
+		const FCollisionResponseContainer* CollisionResponse;
+		FHitResult* Result;		// written when the batch is resolved
+	};
+
+	void Reset()
+	{
+		Queries.Reset();
+		Cells.Reset();
+	}
+
+	int32 Num() const { return Queries.Num(); }
+
+	/** Add a wheel trace, TraceParams/CollisionResponse/Result must remain valid until Resolve has completed */
+	void AddQuery(const FVector& Start, const FVector& End, float SweepRadius, bool bTraceComplex
+		, const FCollisionQueryParams& TraceParams, const FCollisionResponseContainer& CollisionResponse, FHitResult& Result);
+
+	/** Perform all of the queued queries, cells are processed in parallel */
+	void Resolve(UWorld* World, float CellSize, bool bForceSingleThread);
+
+private:
+
+	struct FCell
+	{
+		int32 FirstQuery;
+		int32 NumQueries;
+	};
+
+	void ResolveCell(UWorld* World, const FCell& Cell, TArray<FOverlapResult>& OverlapResults);
+
+	TArray<FQuery> Queries;
+	TArray<FCell> Cells;
+	TArray<TArray<FOverlapResult>> CellOverlapResults;	// overlap scratch per cell, kept between steps so resolving doesn't allocate
+};
@@ -0,0 +1,80 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "Curves/RichCurve.h"
+
+#include "VehicleCurveLUT.generated.h"
+
+/**
+ * A curve baked into uniformly spaced samples across its key range, evaluated with a single indexed lerp instead of
+ * searching the keys. Evaluation outside of the key range is clamped to the first/last sample
+ */
+USTRUCT()
+struct CHAOSVEHICLES_API FVehicleCurveLUT
+{
+	GENERATED_USTRUCT_BODY()
+
+	FVehicleCurveLUT()
+		: MinTime(0.f)
+		, MaxTime(0.f)
+		, InvSampleSpacing(0.f)
+		, MinValue(0.f)
+		, MaxValue(0.f)
+	{
+	}
+
+	/** Sample the curve at Resolution intervals, zero or less uses the p.Vehicle.CurveLUTResolution setting */
+	void Bake(const FRichCurve* Curve, int32 Resolution = 0);
+
+	void Reset()
+	{
+		Samples.Reset();
+		MinTime = MaxTime = 0.f;
+		InvSampleSpacing = 0.f;
+		MinValue = MaxValue = 0.f;
+	}
+
+	/** Has the table been baked, the owner rebakes it whenever its curve changes */
+	bool IsBaked() const { return Samples.Num() > 0; }
+
+	/** Value of the curve at X */
+	float Eval(float X) const
+	{
+		checkSlow(Samples.Num() > 0);
+		const int32 LastSample = Samples.Num() - 1;
+		const float Position = FMath::Clamp((X - MinTime) * InvSampleSpacing, 0.f, (float)LastSample);
+		const int32 Index = FMath::Min((int32)Position, LastSample - 1);
+		return FMath::Lerp(Samples[Index], Samples[Index + 1], Position - (float)Index);
+	}
+
+	/** Time of the first and last keys */
+	float GetMinTime() const { return MinTime; }
+	float GetMaxTime() const { return MaxTime; }
+
+	/** Smallest and largest key values */
+	float GetMinValue() const { return MinValue; }
+	float GetMaxValue() const { return MaxValue; }
+
+private:
+
+	UPROPERTY(Transient)
+	TArray<float> Samples;
+
+	UPROPERTY(Transient)
+	float MinTime;
+
+	UPROPERTY(Transient)
+	float MaxTime;
+
+	UPROPERTY(Transient)
+	float InvSampleSpacing;
+
+	UPROPERTY(Transient)
+	float MinValue;
+
+	UPROPERTY(Transient)
+	float MaxValue;
+};